@@ -22,6 +22,7 @@ local function NewGuardianData()
         curPow = 0, maxPow = 1,
         powType = 0,
         creatureEntry = 0,
+        version = 0,  -- server slot version, see VER
         -- Bonus stats (WoW-like stat accumulators)
         bonusStr = 0, bonusAgi = 0, bonusInt = 0, bonusSta = 0,
         bonusAP = 0, bonusSP = 0,
@@ -40,6 +41,7 @@ for i = 0, MAX_SLOTS - 1 do
 end
 
 local selectedSlot = -1  -- -1 = none selected
+local syncEpoch = 0      -- server epoch the cached slot versions belong to
 local guardianFrames = {}  -- forward declaration; populated after spellbook
 
 local ARCHETYPE_NAMES = { [0] = "DPS", [1] = "Tank", [2] = "Healer" }
@@ -239,6 +241,33 @@ for i = 0, MAX_SLOTS - 1 do
     slotTabs[i] = tab
 end
 
+-- ============================================================================
+-- Loadout Edits
+-- ============================================================================
+
+-- Every spellbook edit sends the complete 8-slot loadout in one request. The
+-- server validates it as a unit and replies with a single SPELLS message
+-- (the current loadout if the edit was rejected).
+local function SendLoadout(spellSlots)
+    local ids = {}
+    for i = 1, NUM_SPELL_SLOTS do
+        ids[i] = spellSlots[i] or 0
+    end
+    SendChatMessage(".capture loadout " .. table.concat(ids, " "), "SAY")
+end
+
+-- Copy of the selected guardian's loadout with one slot replaced
+local function LoadoutWith(slot, spellId)
+    local d = GetSelectedData()
+    if not d then return nil end
+    local slots = {}
+    for i = 1, NUM_SPELL_SLOTS do
+        slots[i] = d.spellSlots[i] or 0
+    end
+    slots[slot] = spellId
+    return slots
+end
+
 -- ============================================================================
 -- Confirmation Dialogs
 -- ============================================================================
@@ -248,7 +277,8 @@ StaticPopupDialogs["CCAPTURE_UNLEARN_SLOT"] = {
     button1 = "Yes",
     button2 = "No",
     OnAccept = function(self, slotData)
-        SendChatMessage(".capture unlearn " .. slotData.slot, "SAY")
+        local slots = LoadoutWith(tonumber(slotData.slot), 0)
+        if slots then SendLoadout(slots) end
     end,
     timeout = 0,
     whileDead = true,
@@ -260,7 +290,8 @@ StaticPopupDialogs["CCAPTURE_TEACH_SLOT"] = {
     button1 = "Yes",
     button2 = "No",
     OnAccept = function(self, teachData)
-        SendChatMessage(".capture teach " .. teachData.slot .. " " .. teachData.spellId, "SAY")
+        local slots = LoadoutWith(teachData.slot, teachData.spellId)
+        if slots then SendLoadout(slots) end
     end,
     timeout = 0,
     whileDead = true,
@@ -377,7 +408,7 @@ for i = 1, NUM_SPELL_SLOTS do
                 d.spellSlots[src] = d.spellSlots[i]
                 d.spellSlots[i] = tmp
                 RefreshSpellbook()
-                SendChatMessage(".capture swap " .. src .. " " .. i, "SAY")
+                SendLoadout(d.spellSlots)
             end
         elseif d.spellSlots[i] > 0 then
             -- No swap pending and slot is filled: enter swap mode
@@ -848,6 +879,16 @@ local function ParseClear(payload)
     RefreshGuardianFrames()
 end
 
+local function ParseVersion(payload)
+    -- VER:<slot>:<epoch>:<version>
+    local parts = {strsplit(":", payload)}
+    local slot = tonumber(parts[2])
+    if not slot or slot < 0 or slot >= MAX_SLOTS then return end
+
+    syncEpoch = tonumber(parts[3]) or 0
+    guardians[slot].version = tonumber(parts[4]) or 0
+end
+
 -- ============================================================================
 -- Item Feeding Helpers
 -- ============================================================================
@@ -1191,6 +1232,182 @@ function RefreshGuardianFrames()
     end
 end
 
+-- ============================================================================
+-- Slot Cache (survives /reload, resynced against server versions)
+-- ============================================================================
+
+local function GetCacheKey()
+    return (UnitName("player") or "") .. "-" .. (GetRealmName() or "")
+end
+
+local function RestoreSlotCache()
+    local cache = CreatureCaptureDB.slotCache
+    local entry = cache and cache[GetCacheKey()]
+    if not entry or not entry.slots then return end
+
+    syncEpoch = entry.epoch or 0
+    for i = 0, MAX_SLOTS - 1 do
+        local saved = entry.slots[i]
+        if saved then
+            local g = NewGuardianData()
+            for k, v in pairs(saved) do
+                g[k] = v
+            end
+            guardians[i] = g
+
+            -- Targeting macros are normally set by NAME/GUID, which an
+            -- up-to-date slot won't be resent
+            local f = guardianFrames[i]
+            if f and g.creatureGuid and not InCombatLockdown() then
+                local name = g.guardianName ~= "" and g.guardianName or "Guardian"
+                f:SetAttribute("macrotext", "/targetexact " .. name)
+            end
+        end
+    end
+end
+
+local function StoreSlotCache()
+    CreatureCaptureDB.slotCache = CreatureCaptureDB.slotCache or {}
+    CreatureCaptureDB.slotCache[GetCacheKey()] = { epoch = syncEpoch, slots = guardians }
+end
+
+-- PLAYER_LOGIN can't tell a UI reload from a fresh login on 3.3.5, and on a
+-- fresh login the server already pushes the full state. Mark reloads as they
+-- are requested so only those restore the cache and sync; a reload that
+-- slips past the hooks just takes the fresh-login path.
+local function MarkReload()
+    CreatureCaptureDB.reloadPending = true
+end
+
+hooksecurefunc("ReloadUI", MarkReload)
+hooksecurefunc("ConsoleExec", function(cmd)
+    if cmd and cmd:lower():match("^%s*reloadui") then
+        MarkReload()
+    end
+end)
+
+local function ConsumeReloadMark()
+    local reloading = CreatureCaptureDB.reloadPending
+    CreatureCaptureDB.reloadPending = nil
+    return reloading
+end
+
+-- Report cached versions; the server resends only the slots that changed
+local function RequestSync()
+    local v = {}
+    for i = 0, MAX_SLOTS - 1 do
+        v[#v + 1] = guardians[i].version or 0
+    end
+    SendChatMessage(".capture sync " .. syncEpoch .. " " .. table.concat(v, " "), "SAY")
+end
+
+-- ============================================================================
+-- Protocol Benchmark (/ccapture bench)
+-- ============================================================================
+
+-- One message per tag, produced by the server's live encoders and sent by
+-- .capture debug protobench as BENCHSAMPLE:<message>
+local benchSamples = {}
+
+local BENCH_PARSERS = {
+    SPELLS = ParseSpells, ARCH = ParseArchetype, NAME = ParseName,
+    GUID = ParseGuid, DISMISS = ParseDismiss, CLEAR = ParseClear,
+    HPOW = ParseHealthPower, ENTRY = ParseEntry, BONUS = ParseBonus,
+    FEEDPREVIEW = ParseFeedPreview, VER = ParseVersion,
+}
+
+-- UI calls the parsers make, replaced while benchmarking so only the decode
+-- is timed
+local BENCH_STUBS = {
+    RefreshSpellbook = function() end,
+    RefreshGuardianFrames = function() end,
+    StaticPopup_Show = function() end,
+    InCombatLockdown = function() return true end,
+}
+
+local function StoreBenchSample(payload)
+    -- BENCHSAMPLE:<message>
+    local msg = payload:sub(#"BENCHSAMPLE:" + 1)
+    local tag = msg:match("^(%u+)")
+    if tag and BENCH_PARSERS[tag] then
+        benchSamples[tag] = msg
+    end
+end
+
+local function CopyGuardianData(g)
+    local copy = {}
+    for k, v in pairs(g) do
+        copy[k] = v
+    end
+    copy.spellSlots = {unpack(g.spellSlots)}
+    return copy
+end
+
+local function RunBenchSamples(iterations, tags, rows)
+    for _, tag in ipairs(tags) do
+        local msg, parse = benchSamples[tag], BENCH_PARSERS[tag]
+
+        collectgarbage("collect")
+        collectgarbage("stop")
+        local kb = collectgarbage("count")
+        local start = debugprofilestop()
+        for _ = 1, iterations do
+            parse(msg)
+        end
+        local elapsedMs = debugprofilestop() - start
+        local garbage = (collectgarbage("count") - kb) * 1024 / iterations
+        collectgarbage("restart")
+
+        rows[#rows + 1] = string.format("  %-12s %4d B  %7.2f us/msg  %5d B garbage/msg",
+            tag, #msg, elapsedMs * 1000 / iterations, garbage)
+    end
+end
+
+local function RunProtocolBench(iterations)
+    local tags = {}
+    for tag in pairs(benchSamples) do
+        tags[#tags + 1] = tag
+    end
+    if #tags == 0 then
+        DEFAULT_CHAT_FRAME:AddMessage("|cff00ff00[Creature Capture]|r No samples yet; run .capture debug protobench first.")
+        return
+    end
+    table.sort(tags)
+
+    -- The parsers write guardian state; put it back afterwards
+    local savedGuardians = {}
+    for i = 0, MAX_SLOTS - 1 do
+        savedGuardians[i] = CopyGuardianData(guardians[i])
+    end
+    local savedSelected, savedEpoch, savedFeedItem = selectedSlot, syncEpoch, feedData.itemEntry
+    local savedGlobals = {}
+    for name, stub in pairs(BENCH_STUBS) do
+        savedGlobals[name] = _G[name]
+        _G[name] = stub
+    end
+
+    local rows = {}
+    local ok, err = pcall(RunBenchSamples, iterations, tags, rows)
+
+    for name, fn in pairs(savedGlobals) do
+        _G[name] = fn
+    end
+    for i = 0, MAX_SLOTS - 1 do
+        guardians[i] = savedGuardians[i]
+    end
+    selectedSlot, syncEpoch, feedData.itemEntry = savedSelected, savedEpoch, savedFeedItem
+    RefreshSpellbook()
+    RefreshGuardianFrames()
+
+    DEFAULT_CHAT_FRAME:AddMessage(string.format("|cff00ff00[Creature Capture]|r Decoded each sample %d times:", iterations))
+    for _, row in ipairs(rows) do
+        DEFAULT_CHAT_FRAME:AddMessage(row)
+    end
+    if not ok then
+        DEFAULT_CHAT_FRAME:AddMessage("|cffff0000[Creature Capture]|r Benchmark failed: " .. tostring(err))
+    end
+end
+
 -- ============================================================================
 -- Event Handling
 -- ============================================================================
@@ -1198,33 +1415,45 @@ end
 local eventFrame = CreateFrame("Frame")
 eventFrame:RegisterEvent("CHAT_MSG_ADDON")
 eventFrame:RegisterEvent("PLAYER_LOGIN")
+eventFrame:RegisterEvent("PLAYER_LOGOUT")
 eventFrame:RegisterEvent("PLAYER_TARGET_CHANGED")
 
+local function DispatchMessage(msg)
+    if msg:find("^SPELLS") then
+        ParseSpells(msg)
+    elseif msg:find("^ARCH") then
+        ParseArchetype(msg)
+    elseif msg:find("^NAME") then
+        ParseName(msg)
+    elseif msg:find("^GUID") then
+        ParseGuid(msg)
+    elseif msg:find("^DISMISS") then
+        ParseDismiss(msg)
+    elseif msg:find("^CLEAR") then
+        ParseClear(msg)
+    elseif msg:find("^HPOW") then
+        ParseHealthPower(msg)
+    elseif msg:find("^ENTRY") then
+        ParseEntry(msg)
+    elseif msg:find("^BONUS") then
+        ParseBonus(msg)
+    elseif msg:find("^FEEDPREVIEW") then
+        ParseFeedPreview(msg)
+    elseif msg:find("^VER") then
+        ParseVersion(msg)
+    elseif msg:find("^BENCHSAMPLE") then
+        StoreBenchSample(msg)
+    end
+end
+
 eventFrame:SetScript("OnEvent", function(self, event, arg1, arg2, ...)
     if event == "CHAT_MSG_ADDON" and arg1 == "CCAPTURE" then
         local msg = arg2
         if not msg then return end
 
-        if msg:find("^SPELLS") then
-            ParseSpells(msg)
-        elseif msg:find("^ARCH") then
-            ParseArchetype(msg)
-        elseif msg:find("^NAME") then
-            ParseName(msg)
-        elseif msg:find("^GUID") then
-            ParseGuid(msg)
-        elseif msg:find("^DISMISS") then
-            ParseDismiss(msg)
-        elseif msg:find("^CLEAR") then
-            ParseClear(msg)
-        elseif msg:find("^HPOW") then
-            ParseHealthPower(msg)
-        elseif msg:find("^ENTRY") then
-            ParseEntry(msg)
-        elseif msg:find("^BONUS") then
-            ParseBonus(msg)
-        elseif msg:find("^FEEDPREVIEW") then
-            ParseFeedPreview(msg)
+        -- The server packs several messages into one whisper, ';'-separated
+        for part in msg:gmatch("[^;]+") do
+            DispatchMessage(part)
         end
 
     elseif event == "PLAYER_TARGET_CHANGED" then
@@ -1235,6 +1464,16 @@ eventFrame:SetScript("OnEvent", function(self, event, arg1, arg2, ...)
         for i = 0, MAX_SLOTS - 1 do
             RestorePosition(guardianFrames[i], "guardianFrame" .. i)
         end
+        if ConsumeReloadMark() then
+            RestoreSlotCache()
+            RefreshSpellbook()
+            RefreshGuardianFrames()
+            RequestSync()
+        end
+
+    elseif event == "PLAYER_LOGOUT" then
+        -- Also fires on /reload, which is when the cache pays off
+        StoreSlotCache()
     end
 end)
 
@@ -1245,6 +1484,12 @@ end)
 SLASH_CCAPTURE1 = "/guardian"
 SLASH_CCAPTURE2 = "/ccapture"
 SlashCmdList["CCAPTURE"] = function(msg)
+    local cmd, arg = (msg or ""):match("^(%S*)%s*(.-)$")
+    if cmd == "bench" then
+        RunProtocolBench(math.max(tonumber(arg) or 1000, 1))
+        return
+    end
+
     if spellbook:IsShown() then
         spellbook:Hide()
     else
@@ -0,0 +1,41 @@
+-- Creature Capture per-map / per-zone rules
+-- A row with zone_id = 0 applies to the whole map; a row with a zone_id
+-- applies to that zone and overrides its map's row. Places without a row
+-- allow capture and every guardian slot.
+-- Reload in game with: .capture reload rules
+
+CREATE TABLE IF NOT EXISTS `creature_capture_rules` (
+    `map_id` SMALLINT UNSIGNED NOT NULL DEFAULT 0,
+    `zone_id` SMALLINT UNSIGNED NOT NULL DEFAULT 0 COMMENT '0 = whole map',
+    `allow_capture` TINYINT UNSIGNED NOT NULL DEFAULT 1 COMMENT '0 = capturing is refused',
+    `max_guardians` TINYINT UNSIGNED NOT NULL DEFAULT 4 COMMENT 'Guardians that may be summoned at once, 0 = none',
+    `comment` VARCHAR(255) NOT NULL DEFAULT '',
+    PRIMARY KEY (`map_id`, `zone_id`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='Creature Capture Module - Zone Rules';
+
+-- Arenas: no guardians, no capture
+DELETE FROM `creature_capture_rules` WHERE `map_id` IN (559, 562, 572, 617, 618) AND `zone_id` = 0;
+INSERT INTO `creature_capture_rules` (`map_id`, `zone_id`, `allow_capture`, `max_guardians`, `comment`) VALUES
+(559, 0, 0, 0, 'Nagrand Arena'),
+(562, 0, 0, 0, 'Blade''s Edge Arena'),
+(572, 0, 0, 0, 'Ruins of Lordaeron'),
+(617, 0, 0, 0, 'Dalaran Sewers'),
+(618, 0, 0, 0, 'Ring of Valor');
+
+-- Capital cities: no capture
+DELETE FROM `creature_capture_rules` WHERE `zone_id` IN (1519, 1537, 1657, 3557, 1637, 1638, 1497, 3487, 3703, 4395);
+INSERT INTO `creature_capture_rules` (`map_id`, `zone_id`, `allow_capture`, `max_guardians`, `comment`) VALUES
+(0,   1519, 0, 4, 'Stormwind City'),
+(0,   1537, 0, 4, 'Ironforge'),
+(1,   1657, 0, 4, 'Darnassus'),
+(530, 3557, 0, 4, 'The Exodar'),
+(1,   1637, 0, 4, 'Orgrimmar'),
+(1,   1638, 0, 4, 'Thunder Bluff'),
+(0,   1497, 0, 4, 'Undercity'),
+(530, 3487, 0, 4, 'Silvermoon City'),
+(530, 3703, 0, 4, 'Shattrath City'),
+(571, 4395, 0, 4, 'Dalaran');
+
+-- Example: limit raids to one guardian
+-- INSERT INTO `creature_capture_rules` (`map_id`, `zone_id`, `allow_capture`, `max_guardians`, `comment`) VALUES
+-- (533, 0, 0, 1, 'Naxxramas');
@@ -0,0 +1,26 @@
+# Optional profiler zones for mod-creature-capture.
+#
+# Off by default. When off, the CC_PROFILE_* macros in the module compile to
+# nothing. When on, the module includes <tracy/Tracy.hpp> and emits zones for
+# the guardian AI, UnitScript hooks, summoning, DB save/load and item bonus
+# extraction. The Tracy client (TracyClient.cpp) must also be built into the
+# worldserver for the zones to reach the profiler.
+
+option(MOD_CREATURE_CAPTURE_PROFILE "mod-creature-capture: compile in Tracy profiler zones" OFF)
+set(MOD_CREATURE_CAPTURE_TRACY_DIR "" CACHE PATH "mod-creature-capture: Tracy source tree (contains public/tracy/Tracy.hpp)")
+
+if (MOD_CREATURE_CAPTURE_PROFILE)
+  # This file is included into the shared modules directory, so scope the
+  # definitions and include path to this module's sources; directory-wide
+  # settings would turn TRACY_ENABLE on for every other module too.
+  file(GLOB_RECURSE MOD_CREATURE_CAPTURE_SOURCES
+    "${CMAKE_CURRENT_LIST_DIR}/src/*.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/src/*.h")
+  set_property(SOURCE ${MOD_CREATURE_CAPTURE_SOURCES}
+    APPEND PROPERTY COMPILE_DEFINITIONS MOD_CREATURE_CAPTURE_PROFILE TRACY_ENABLE)
+  if (MOD_CREATURE_CAPTURE_TRACY_DIR)
+    set_property(SOURCE ${MOD_CREATURE_CAPTURE_SOURCES}
+      APPEND PROPERTY INCLUDE_DIRECTORIES "${MOD_CREATURE_CAPTURE_TRACY_DIR}/public")
+  endif()
+  message(STATUS "mod-creature-capture: profiler zones enabled")
+endif()
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>
+ * Released under GNU AGPL v3 license
+ *
+ * Creature Capture Module — public read-only API
+ * Lets other modules read a player's live guardians and follow capture,
+ * release and level changes without touching character_guardian.
+ */
+
+#ifndef MOD_CREATURE_CAPTURE_API_H
+#define MOD_CREATURE_CAPTURE_API_H
+
+#include "Define.h"
+#include "ObjectGuid.h"
+
+class Player;
+struct GuardianSlotData;
+
+namespace CreatureCapture
+{
+    constexpr uint8 MAX_SLOTS = 4;
+
+    // Combat values derived from a slot's raw bonus stats. Cached on the slot
+    // and refreshed whenever the bonuses change, so the damage/outcome hooks
+    // read precomputed numbers instead of re-deriving them on every hit.
+    struct GuardianDerivedStats
+    {
+        uint32 health     = 0;
+        uint32 mana       = 0;
+        float  meleeAP    = 0.0f;
+        float  rangedAP   = 0.0f;
+        float  spellPower = 0.0f;
+        float  critPct    = 0.0f;
+        float  dodgePct   = 0.0f;
+        float  parryPct   = 0.0f;
+        float  blockPct   = 0.0f;
+        float  hastePct   = 0.0f;
+    };
+
+    enum GuardianArchetype : uint8
+    {
+        GUARDIAN_ARCHETYPE_DPS    = 0,
+        GUARDIAN_ARCHETYPE_TANK   = 1,
+        GUARDIAN_ARCHETYPE_HEALER = 2,
+    };
+
+    // Non-owning view over one of a player's guardian slots. Reads the live
+    // slot, so it sees every change as it happens; it is only valid while
+    // the owner is in the world and must be used from the owner's map thread
+    // (player scripts, the owner's map update, or the owner's commands).
+    // Do not keep views across updates.
+    class GuardianView
+    {
+    public:
+        GuardianView() = default;
+        GuardianView(GuardianSlotData const* slot, uint8 index) : _slot(slot), _index(index) {}
+
+        bool IsValid() const { return _slot != nullptr; }
+        uint8 Slot() const { return _index; }
+
+        bool       IsOccupied() const;
+        bool       IsSummoned() const;   // currently in the world
+        bool       IsDismissed() const;  // stored by the owner, not auto-summoned
+        uint32     Entry() const;        // creature_template entry
+        uint8      Level() const;
+        uint8      Archetype() const;    // GuardianArchetype
+        ObjectGuid ActiveGuid() const;   // empty unless summoned
+        GuardianDerivedStats const& Stats() const;
+
+    private:
+        GuardianSlotData const* _slot = nullptr;
+        uint8 _index = 0;
+    };
+
+    // Fills `out` with the owner's occupied slots and returns how many were
+    // written. No allocation, no database access.
+    uint8 GetGuardians(Player* owner, GuardianView (&out)[MAX_SLOTS]);
+
+    // View of one slot, or an invalid view if the owner has no guardian data
+    // or the slot is out of range. The slot may be empty.
+    GuardianView GetGuardian(Player* owner, uint8 slot);
+
+    // Event callbacks. Hooks run synchronously on the thread that raised the
+    // event (the owner's map thread) and must be cheap; the view is valid for
+    // the duration of the call only.
+    class GuardianListener
+    {
+    public:
+        virtual ~GuardianListener() = default;
+
+        virtual void OnGuardianCaptured(Player* /*owner*/, GuardianView /*guardian*/) { }
+        // Raised before the slot is cleared, so the view still describes the
+        // released guardian. `progressKept` is true when spells and bonuses
+        // stay in the slot for the next capture.
+        virtual void OnGuardianReleased(Player* /*owner*/, GuardianView /*guardian*/, bool /*progressKept*/) { }
+        virtual void OnGuardianLevelChanged(Player* /*owner*/, GuardianView /*guardian*/, uint8 /*oldLevel*/) { }
+    };
+
+    // Register from a module's AddSC_ function, before the world starts.
+    // Listeners are never removed and are not owned.
+    void AddGuardianListener(GuardianListener* listener);
+}
+
+#endif
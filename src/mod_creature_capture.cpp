@@ -7,6 +7,8 @@
  * Supports up to 4 guardian slots per player with archetype system (Tank/DPS/Healer).
  */
 
+#include "CreatureCaptureAPI.h"
+#include "AsyncCallbackProcessor.h"
 #include "Chat.h"
 #include "CommandScript.h"
 #include "Config.h"
@@ -14,12 +16,16 @@
 #include "CreatureAI.h"
 #include "DatabaseEnv.h"
 #include "DataMap.h"
+#include "GameTime.h"
+#include "GitRevision.h"
 #include "ItemScript.h"
+#include "Log.h"
 #include "Map.h"
 #include "MotionMaster.h"
 #include "ObjectAccessor.h"
 #include "Pet.h"
 #include "Player.h"
+#include "QueryCallback.h"
 #include "ScriptedGossip.h"
 #include "ScriptMgr.h"
 #include "Spell.h"
@@ -29,17 +35,57 @@
 #include "SpellScriptLoader.h"
 #include "TemporarySummon.h"
 #include "Unit.h"
+#include "World.h"
 #include "WorldPacket.h"
 #include "DBCStores.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <functional>
 #include <iomanip>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Profiler zones. Compiled in only when the module is built with
+// MOD_CREATURE_CAPTURE_PROFILE (see mod-creature-capture.cmake); otherwise
+// every macro expands to nothing and its arguments are never evaluated.
+#ifdef MOD_CREATURE_CAPTURE_PROFILE
+#include <cstring>
+#include <tracy/Tracy.hpp>
+#define CC_PROFILE_ZONE(name)             ZoneScopedN(name)
+#define CC_PROFILE_ANNOTATE(entry, arch)  do { ZoneValue(entry); \
+    char const* _ccArch = ArchetypeName(arch); ZoneText(_ccArch, std::strlen(_ccArch)); } while (0)
+#else
+#define CC_PROFILE_ZONE(name)             ((void)0)
+#define CC_PROFILE_ANNOTATE(entry, arch)  ((void)0)
+#endif
+
 // Tesseract item constant (uses existing item 44807 from client Item.dbc)
 constexpr uint32 ITEM_TESSERACT = 44807;
 
@@ -143,19 +189,41 @@ static uint32 CalculateBaseMana(uint8 level)
     return 200 + level * 15;  // ~200 at L1, ~1400 at L80
 }
 
+// Per-level gold costs, computed once at module load so menus and gossip
+// handlers never call std::pow.
+struct GuardianCostTables
+{
+    uint32 resourceSwitch[256];
+    uint32 preserve[256];
+
+    GuardianCostTables()
+    {
+        for (uint32 level = 0; level < 256; ++level)
+        {
+            // 1.07^level gold
+            double cost = std::pow(1.07, static_cast<double>(level));
+            resourceSwitch[level] = static_cast<uint32>(cost * 10000); // gold to copper
+
+            // floor(0.5 * 1.1^level) gold, 0 (free) at very low levels
+            uint32 gold = static_cast<uint32>(std::floor(0.5 * std::pow(1.1, static_cast<double>(level))));
+            preserve[level] = gold * 10000;
+        }
+    }
+};
+
+static GuardianCostTables const s_costTables;
+
 // Cost in copper for switching guardian resource type (1.07^level gold)
 static uint32 CalculateResourceSwitchCost(uint8 level)
 {
-    double cost = std::pow(1.07, static_cast<double>(level));
-    return static_cast<uint32>(cost * 10000); // gold to copper
+    return s_costTables.resourceSwitch[level];
 }
 
 // Cost in copper to preserve a slot's progress on release: floor(0.5 * 1.1^level) gold.
 // Returns 0 for very low levels (effectively free).
 static uint32 CalculatePreserveCost(uint8 level)
 {
-    uint32 gold = static_cast<uint32>(std::floor(0.5 * std::pow(1.1, static_cast<double>(level))));
-    return gold * 10000;
+    return s_costTables.preserve[level];
 }
 
 // ============================================================================
@@ -178,6 +246,60 @@ struct CreatureCaptureConfig
     uint32 leechChance = 10;
     uint32 leechPct = 2;
 
+    // Feed preview coalescing
+    uint32 feedPreviewDelayMs = 150;
+    uint32 feedPreviewCacheMs = 5000;
+
+    // Event log (read once at startup)
+    bool        eventLogEnabled   = false;
+    std::string eventLogFile      = "creature_capture_events.log";
+    uint32      eventLogQueueSize = 8192;
+    uint32      eventLogFlushMs   = 1000;
+    uint32      eventLogMaxFileMB = 64;
+    uint32      eventLogMaxFiles  = 5;
+
+    // Login load batching
+    bool   loginBatchEnabled  = true;
+    uint32 loginBatchWindowMs = 30;
+    uint32 loginBatchMaxSize  = 50;
+
+    // Idle-owner dormancy
+    bool   dormancyEnabled     = true;
+    uint32 dormancyIdleSeconds = 120;
+
+    // Addon message outbox
+    bool   addonOutboxEnabled   = true;
+
+    // Startup table cache (read once at startup)
+    bool        tableCacheEnabled = true;
+    std::string tableCacheFile    = "creature_capture_tables.bin";
+
+    // Parallel guardian decisions (read once at startup)
+    bool   parallelAIEnabled      = false;
+    uint32 parallelAIThreads      = 2;
+    uint32 parallelAIMinGuardians = 64;
+
+    // Warm relog cache
+    bool   warmCacheEnabled     = true;
+    uint32 warmCacheTtlSeconds  = 300;
+    uint32 warmCacheMaxKB       = 4096;
+
+    // Bulk audit of character_guardian
+    uint32 auditBatchSize       = 500;
+    uint32 auditIntervalMs      = 250;
+    uint32 auditMaxBonus        = 100000;
+
+    // Guardian write lane (read once at startup)
+    bool   writeLaneEnabled     = true;
+    uint32 writeLaneWorkers     = 1;
+    uint32 writeLaneConnections = 1;
+    uint32 writeLaneMaxPending  = 4096;
+
+    // Tank threat upkeep
+    bool   tankThreatDelta      = true;
+    uint32 tankThreatMarginPct  = 130;
+    uint32 tankThreatIntervalMs = 1000;
+
     void Load()
     {
         enabled = sConfigMgr->GetOption<bool>("CreatureCapture.Enable", true);
@@ -194,16 +316,391 @@ struct CreatureCaptureConfig
         maxSlots = std::max(uint8(1), std::min(uint8(MAX_GUARDIAN_SLOTS), slots));
         leechChance = sConfigMgr->GetOption<uint32>("CreatureCapture.LeechChance", 10);
         leechPct = sConfigMgr->GetOption<uint32>("CreatureCapture.LeechPct", 2);
+        feedPreviewDelayMs = sConfigMgr->GetOption<uint32>("CreatureCapture.FeedPreview.DelayMs", 150);
+        feedPreviewCacheMs = sConfigMgr->GetOption<uint32>("CreatureCapture.FeedPreview.CacheMs", 5000);
+        eventLogEnabled   = sConfigMgr->GetOption<bool>("CreatureCapture.EventLog.Enable", false);
+        eventLogFile      = sConfigMgr->GetOption<std::string>("CreatureCapture.EventLog.File", "creature_capture_events.log");
+        eventLogQueueSize = std::max<uint32>(64, sConfigMgr->GetOption<uint32>("CreatureCapture.EventLog.QueueSize", 8192));
+        eventLogFlushMs   = std::max<uint32>(50, sConfigMgr->GetOption<uint32>("CreatureCapture.EventLog.FlushIntervalMs", 1000));
+        eventLogMaxFileMB = sConfigMgr->GetOption<uint32>("CreatureCapture.EventLog.MaxFileSizeMB", 64);
+        eventLogMaxFiles  = sConfigMgr->GetOption<uint32>("CreatureCapture.EventLog.MaxFiles", 5);
+        loginBatchEnabled  = sConfigMgr->GetOption<bool>("CreatureCapture.LoginBatch.Enable", true);
+        loginBatchWindowMs = sConfigMgr->GetOption<uint32>("CreatureCapture.LoginBatch.WindowMs", 30);
+        loginBatchMaxSize  = std::max<uint32>(1, sConfigMgr->GetOption<uint32>("CreatureCapture.LoginBatch.MaxSize", 50));
+        dormancyEnabled     = sConfigMgr->GetOption<bool>("CreatureCapture.Dormancy.Enable", true);
+        dormancyIdleSeconds = sConfigMgr->GetOption<uint32>("CreatureCapture.Dormancy.IdleSeconds", 120);
+        addonOutboxEnabled   = sConfigMgr->GetOption<bool>("CreatureCapture.AddonOutbox.Enable", true);
+        tableCacheEnabled      = sConfigMgr->GetOption<bool>("CreatureCapture.TableCache.Enable", true);
+        tableCacheFile         = sConfigMgr->GetOption<std::string>("CreatureCapture.TableCache.File", "creature_capture_tables.bin");
+        parallelAIEnabled      = sConfigMgr->GetOption<bool>("CreatureCapture.ParallelAI.Enable", false);
+        parallelAIThreads      = std::clamp<uint32>(sConfigMgr->GetOption<uint32>("CreatureCapture.ParallelAI.Threads", 2), 1, 16);
+        parallelAIMinGuardians = sConfigMgr->GetOption<uint32>("CreatureCapture.ParallelAI.MinGuardians", 64);
+        warmCacheEnabled     = sConfigMgr->GetOption<bool>("CreatureCapture.WarmCache.Enable", true);
+        warmCacheTtlSeconds  = sConfigMgr->GetOption<uint32>("CreatureCapture.WarmCache.TtlSeconds", 300);
+        warmCacheMaxKB       = sConfigMgr->GetOption<uint32>("CreatureCapture.WarmCache.MaxKB", 4096);
+        auditBatchSize       = std::clamp<uint32>(sConfigMgr->GetOption<uint32>("CreatureCapture.Audit.BatchSize", 500), 10, 10000);
+        auditIntervalMs      = sConfigMgr->GetOption<uint32>("CreatureCapture.Audit.IntervalMs", 250);
+        auditMaxBonus        = sConfigMgr->GetOption<uint32>("CreatureCapture.Audit.MaxBonus", 100000);
+        writeLaneEnabled     = sConfigMgr->GetOption<bool>("CreatureCapture.WriteLane.Enable", true);
+        writeLaneWorkers     = std::clamp<uint32>(sConfigMgr->GetOption<uint32>("CreatureCapture.WriteLane.Workers", 1), 1, 8);
+        writeLaneConnections = std::clamp<uint32>(sConfigMgr->GetOption<uint32>("CreatureCapture.WriteLane.Connections", 1), 1, 8);
+        writeLaneMaxPending  = std::max<uint32>(16, sConfigMgr->GetOption<uint32>("CreatureCapture.WriteLane.MaxPending", 4096));
+        tankThreatDelta      = sConfigMgr->GetOption<bool>("CreatureCapture.TankThreat.Delta", true);
+        tankThreatMarginPct  = std::max<uint32>(100, sConfigMgr->GetOption<uint32>("CreatureCapture.TankThreat.MarginPct", 130));
+        tankThreatIntervalMs = sConfigMgr->GetOption<uint32>("CreatureCapture.TankThreat.IntervalMs", 1000);
     }
 };
 
 static CreatureCaptureConfig config;
 
+// ============================================================================
+// Module Metrics — lock-free counters, read by .capture debug stats
+// ============================================================================
+
+struct CreatureCaptureMetrics
+{
+    std::atomic<uint64> eventsLogged    { 0 };
+    std::atomic<uint64> eventsDropped   { 0 };
+    std::atomic<uint64> eventBatches    { 0 };
+    std::atomic<uint64> eventRotations  { 0 };
+
+    std::atomic<uint64> feedPreviewRequests  { 0 };
+    std::atomic<uint64> feedPreviewServed    { 0 };   // full extraction + reply
+    std::atomic<uint64> feedPreviewCacheHits { 0 };
+    std::atomic<uint64> feedPreviewDropped   { 0 };   // superseded while pending
+
+    std::atomic<uint64> loginBatches     { 0 };   // multi-owner IN (...) queries
+    std::atomic<uint64> loginBatchOwners { 0 };   // owners served by those queries
+    std::atomic<uint64> loginSingleLoads { 0 };   // windows that closed with one owner
+
+    std::atomic<uint64> dormantGuardians { 0 };   // currently dormant (gauge)
+    std::atomic<uint64> dormancyEntries  { 0 };
+    std::atomic<uint64> dormancyWakes    { 0 };
+
+    std::atomic<uint64> threatMutations  { 0 };   // AddThreat calls made by tank guardians
+    std::atomic<uint64> threatHeldSkips  { 0 };   // enemy already held with margin
+    std::atomic<uint64> threatRateSkips  { 0 };   // enemy topped up too recently
+    std::atomic<uint64> tankActiveMs     { 0 };   // summed in-combat tank AI time
+
+    std::atomic<uint64> outboxQueued     { 0 };   // addon messages handed to the outbox
+    std::atomic<uint64> outboxSuperseded { 0 };   // dropped unsent for a newer one
+    std::atomic<uint64> outboxPackets    { 0 };   // SMSG_MESSAGECHAT whispers sent
+
+    std::atomic<uint64> aiBatches        { 0 };   // world-thread decide passes
+    std::atomic<uint64> aiBatchDecisions { 0 };   // guardian snapshots decided in those passes
+    std::atomic<uint64> aiBatchApplied   { 0 };   // batched decisions that ended in a cast
+    std::atomic<uint64> aiDecideUs       { 0 };   // wall time spent deciding
+
+    std::atomic<uint64> warmHits         { 0 };   // logins hydrated from memory (one SELECT saved each)
+    std::atomic<uint64> warmMisses       { 0 };   // not cached or expired
+    std::atomic<uint64> warmStale        { 0 };   // dropped by a write after logout
+    std::atomic<uint64> warmEvictions    { 0 };   // pushed out by WarmCache.MaxKB
+
+    std::atomic<uint64> laneDepth        { 0 };   // writes waiting in the lane (gauge)
+    std::atomic<uint64> laneQueued       { 0 };
+    std::atomic<uint64> laneCoalesced    { 0 };   // replaced a pending write for the same slot
+    std::atomic<uint64> laneOverflow     { 0 };   // lane full, sent through CharacterDatabase instead
+    std::atomic<uint64> laneWritten      { 0 };
+    std::atomic<uint64> laneLatencySumMs { 0 };   // first enqueue -> commit
+    std::atomic<uint64> laneLatencyMaxMs { 0 };
+};
+
+static CreatureCaptureMetrics metrics;
+
+// ============================================================================
+// Event Log — asynchronous NDJSON stream of capture lifecycle events
+// ============================================================================
+
+enum CaptureEventType : uint8
+{
+    CAPTURE_EVENT_CAPTURE = 0,  // arg1: -
+    CAPTURE_EVENT_FEED    = 1,  // arg1: item entry
+    CAPTURE_EVENT_LEECH   = 2,  // arg1: total stat points gained
+    CAPTURE_EVENT_LEVEL   = 3,  // arg1: previous level
+    CAPTURE_EVENT_RELEASE = 4,  // arg1: 1 = progress preserved, 0 = wiped
+    CAPTURE_EVENT_KILL    = 5,  // arg1: victim entry
+    CAPTURE_EVENT_DEATH   = 6,  // arg1: killer entry (0 = player or unknown)
+    MAX_CAPTURE_EVENT
+};
+
+static constexpr char const* CAPTURE_EVENT_NAMES[MAX_CAPTURE_EVENT] =
+    { "capture", "feed", "leech", "level", "release", "kill", "death" };
+static constexpr char const* CAPTURE_EVENT_ARG_NAMES[MAX_CAPTURE_EVENT] =
+    { nullptr, "item", "gain", "old_level", "preserved", "victim", "killer" };
+
+// Fixed-size record so producers never allocate; JSON formatting happens on
+// the writer thread.
+struct CaptureEvent
+{
+    uint64 timeMs    = 0;   // unix epoch, milliseconds
+    uint32 owner     = 0;   // owner character guid (low part)
+    uint32 entry     = 0;   // guardian creature entry
+    uint32 arg1      = 0;   // see CaptureEventType
+    uint8  type      = 0;
+    uint8  slot      = 0;
+    uint8  level     = 0;
+    uint8  archetype = 0;
+};
+
+// Bounded multi-producer / single-consumer ring (Vyukov's sequence-per-cell
+// design). Producers on map threads pay one CAS; when the ring is full the
+// event is rejected and the caller counts a drop instead of blocking.
+class CaptureEventQueue
+{
+public:
+    void Init(size_t capacity)
+    {
+        size_t cap = 1;
+        while (cap < capacity)
+            cap <<= 1;
+
+        _cells = std::make_unique<Cell[]>(cap);
+        _mask  = cap - 1;
+        for (size_t i = 0; i < cap; ++i)
+            _cells[i].seq.store(i, std::memory_order_relaxed);
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos = 0;
+    }
+
+    bool Push(CaptureEvent const& ev)
+    {
+        Cell* cell;
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &_cells[pos & _mask];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->event = ev;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Single consumer only (the writer thread)
+    bool Pop(CaptureEvent& out)
+    {
+        Cell& cell = _cells[_dequeuePos & _mask];
+        size_t seq = cell.seq.load(std::memory_order_acquire);
+        if (intptr_t(seq) - intptr_t(_dequeuePos + 1) < 0)
+            return false;
+
+        out = cell.event;
+        cell.seq.store(_dequeuePos + _mask + 1, std::memory_order_release);
+        ++_dequeuePos;
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> seq { 0 };
+        CaptureEvent event;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask = 0;
+    alignas(64) std::atomic<size_t> _enqueuePos { 0 };
+    alignas(64) size_t _dequeuePos = 0;
+};
+
+// Background writer: wakes every FlushIntervalMs, drains the ring into one
+// buffer and writes it with a single fwrite. Rotates to <file>.1 .. <file>.N
+// when the active file would exceed MaxFileSizeMB.
+class CaptureEventLog
+{
+public:
+    ~CaptureEventLog() { Stop(); }
+
+    void Start()
+    {
+        if (_running || !config.eventLogEnabled)
+            return;
+
+        _path = config.eventLogFile;
+        if (!_path.empty() && _path[0] != '/')
+        {
+            std::string logsDir = sConfigMgr->GetOption<std::string>("LogsDir", "");
+            if (!logsDir.empty() && logsDir.back() != '/' && logsDir.back() != '\\')
+                logsDir += '/';
+            _path = logsDir + _path;
+        }
+
+        _maxBytes = uint64(config.eventLogMaxFileMB) * 1024 * 1024;
+        _maxFiles = config.eventLogMaxFiles;
+        _flushMs  = config.eventLogFlushMs;
+
+        if (!OpenFile())
+        {
+            LOG_ERROR("module", "mod-creature-capture: cannot open event log '{}', event log disabled", _path);
+            return;
+        }
+
+        _queue.Init(config.eventLogQueueSize);
+        _accepting.store(true, std::memory_order_release);
+        _running = true;
+        _worker = std::thread(&CaptureEventLog::WorkerLoop, this);
+
+        LOG_INFO("module", "mod-creature-capture: event log writing to '{}'", _path);
+    }
+
+    void Stop()
+    {
+        if (!_running)
+            return;
+
+        _accepting.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(_wakeLock);
+            _running = false;
+        }
+        _wake.notify_one();
+        if (_worker.joinable())
+            _worker.join();
+
+        if (_file)
+        {
+            std::fclose(_file);
+            _file = nullptr;
+        }
+    }
+
+    void Log(CaptureEvent const& ev)
+    {
+        if (!_accepting.load(std::memory_order_acquire))
+            return;
+
+        if (_queue.Push(ev))
+            metrics.eventsLogged.fetch_add(1, std::memory_order_relaxed);
+        else
+            metrics.eventsDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    bool OpenFile()
+    {
+        _file = std::fopen(_path.c_str(), "ab");
+        if (!_file)
+            return false;
+        std::fseek(_file, 0, SEEK_END);
+        _fileSize = uint64(std::ftell(_file));
+        return true;
+    }
+
+    void Rotate()
+    {
+        std::fclose(_file);
+        _file = nullptr;
+
+        if (_maxFiles > 0)
+        {
+            std::remove(fmt::format("{}.{}", _path, _maxFiles).c_str());
+            for (uint32 i = _maxFiles; i > 1; --i)
+                std::rename(fmt::format("{}.{}", _path, i - 1).c_str(), fmt::format("{}.{}", _path, i).c_str());
+            std::rename(_path.c_str(), fmt::format("{}.1", _path).c_str());
+        }
+        else
+            std::remove(_path.c_str());
+
+        OpenFile();
+        metrics.eventRotations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void WorkerLoop()
+    {
+        std::string buffer;
+        uint64 reportedDrops = 0;
+
+        for (;;)
+        {
+            bool running;
+            {
+                std::unique_lock<std::mutex> lock(_wakeLock);
+                _wake.wait_for(lock, std::chrono::milliseconds(_flushMs), [this] { return !_running; });
+                running = _running;
+            }
+
+            buffer.clear();
+            CaptureEvent ev;
+            while (_queue.Pop(ev))
+                AppendJson(buffer, ev);
+
+            // Drops are reported in-stream so gaps in the data are visible
+            uint64 drops = metrics.eventsDropped.load(std::memory_order_relaxed);
+            if (drops != reportedDrops)
+            {
+                buffer += fmt::format("{{\"t\":{},\"event\":\"dropped\",\"count\":{}}}\n", NowMs(), drops - reportedDrops);
+                reportedDrops = drops;
+            }
+
+            if (!buffer.empty() && _file)
+            {
+                if (_maxBytes && _fileSize + buffer.size() > _maxBytes && _fileSize > 0)
+                    Rotate();
+                if (_file)
+                {
+                    std::fwrite(buffer.data(), 1, buffer.size(), _file);
+                    std::fflush(_file);
+                    _fileSize += buffer.size();
+                    metrics.eventBatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            if (!running)
+                break;
+        }
+    }
+
+    static void AppendJson(std::string& out, CaptureEvent const& ev)
+    {
+        uint8 type = ev.type < MAX_CAPTURE_EVENT ? ev.type : CAPTURE_EVENT_CAPTURE;
+        out += fmt::format("{{\"t\":{},\"event\":\"{}\",\"owner\":{},\"slot\":{},\"entry\":{},\"level\":{},\"archetype\":\"{}\"",
+            ev.timeMs, CAPTURE_EVENT_NAMES[type], ev.owner, uint32(ev.slot), ev.entry, uint32(ev.level), ArchetypeName(ev.archetype));
+        if (char const* argName = CAPTURE_EVENT_ARG_NAMES[type])
+            out += fmt::format(",\"{}\":{}", argName, ev.arg1);
+        out += "}\n";
+    }
+
+public:
+    static uint64 NowMs()
+    {
+        return uint64(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+private:
+    CaptureEventQueue _queue;
+    std::thread _worker;
+    std::mutex _wakeLock;
+    std::condition_variable _wake;
+    bool _running = false;
+    std::atomic<bool> _accepting { false };
+
+    std::string _path;
+    FILE*  _file     = nullptr;
+    uint64 _fileSize = 0;
+    uint64 _maxBytes = 0;
+    uint32 _maxFiles = 0;
+    uint32 _flushMs  = 1000;
+};
+
+static CaptureEventLog s_eventLog;
+
 // ============================================================================
 // Addon Message Helpers (slot-aware)
 // ============================================================================
 
-static void SendCaptureAddonMessage(Player* player, std::string const& msg)
+static void SendAddonPacket(Player* player, std::string const& msg)
 {
     WorldPacket data;
     std::size_t len = msg.length();
@@ -217,77 +714,251 @@ static void SendCaptureAddonMessage(Player* player, std::string const& msg)
     data << msg;
     data << uint8(0);
     player->GetSession()->SendPacket(&data);
+    metrics.outboxPackets.fetch_add(1, std::memory_order_relaxed);
 }
 
-static void SendGuardianSpells(Player* player, uint8 slot, uint32 const* spells)
+// Per-player queue of addon messages, flushed once at the end of the player's
+// update. Messages are keyed by "TAG:slot"; a newer message replaces an unsent
+// one with the same key and moves to the back, and CLEAR drops everything
+// pending for its slot. What survives is packed, ';'-separated, under a single
+// prefix into as few whispers as fit the client's addon message limit. No
+// message body may contain ';' (creature names don't).
+struct AddonOutbox : public DataMap::Base
+{
+    static constexpr size_t MAX_PACKET_LEN = 255;   // prefix + '\t' + bodies
+    static constexpr char   SEPARATOR      = ';';
+
+    struct Pending
+    {
+        std::string key;
+        std::string body;
+    };
+
+    std::vector<Pending> pending;
+
+    void Push(std::string body)
+    {
+        metrics.outboxQueued.fetch_add(1, std::memory_order_relaxed);
+
+        std::size_t tagEnd  = body.find(':');
+        std::size_t slotEnd = tagEnd == std::string::npos ? std::string::npos : body.find(':', tagEnd + 1);
+        std::string key = body.substr(0, slotEnd);
+
+        std::size_t before = pending.size();
+        if (key.compare(0, 6, "CLEAR:") == 0)
+        {
+            std::string slotSuffix = key.substr(5);   // ":<slot>"
+            pending.erase(std::remove_if(pending.begin(), pending.end(), [&](Pending const& p)
+            {
+                std::size_t colon = p.key.find(':');
+                return colon != std::string::npos && p.key.compare(colon, std::string::npos, slotSuffix) == 0;
+            }), pending.end());
+        }
+        else
+        {
+            pending.erase(std::remove_if(pending.begin(), pending.end(),
+                [&](Pending const& p) { return p.key == key; }), pending.end());
+        }
+        metrics.outboxSuperseded.fetch_add(before - pending.size(), std::memory_order_relaxed);
+
+        pending.push_back({ std::move(key), std::move(body) });
+    }
+
+    void Flush(Player* player)
+    {
+        if (pending.empty())
+            return;
+
+        std::vector<std::string> packets;
+        Pack(pending, packets);
+        for (std::string const& packet : packets)
+            SendAddonPacket(player, packet);
+
+        pending.clear();
+    }
+
+    static void Pack(std::vector<Pending> const& bodies, std::vector<std::string>& packets)
+    {
+        std::string const head = std::string(ADDON_PREFIX) + "\t";
+        std::string packet = head;
+        for (Pending const& p : bodies)
+        {
+            // A body that fills a packet on its own goes out alone
+            bool alone = head.size() + p.body.size() >= MAX_PACKET_LEN;
+            bool fits = packet.size() + 1 + p.body.size() <= MAX_PACKET_LEN;
+
+            if (packet.size() > head.size() && (alone || !fits))
+            {
+                packets.push_back(std::move(packet));
+                packet = head;
+            }
+
+            if (alone)
+            {
+                packets.push_back(head + p.body);
+                continue;
+            }
+
+            if (packet.size() > head.size())
+                packet += SEPARATOR;
+            packet += p.body;
+        }
+
+        if (packet.size() > head.size())
+            packets.push_back(std::move(packet));
+    }
+};
+
+static std::string const ADDON_OUTBOX_KEY = "CaptureAddonOutbox";
+
+static void SendCaptureAddonMessage(Player* player, std::string const& msg)
+{
+    if (!config.addonOutboxEnabled)
+    {
+        SendAddonPacket(player, msg);
+        return;
+    }
+
+    // Callers build "PREFIX\tBODY"; the outbox re-adds the prefix per packet
+    std::size_t tab = msg.find('\t');
+    player->CustomData.GetDefault<AddonOutbox>(ADDON_OUTBOX_KEY)->Push(
+        tab == std::string::npos ? msg : msg.substr(tab + 1));
+}
+
+static void FlushCaptureAddonMessages(Player* player)
+{
+    if (AddonOutbox* outbox = player->CustomData.Get<AddonOutbox>(ADDON_OUTBOX_KEY))
+        outbox->Flush(player);
+}
+
+static std::string EncodeGuardianSpells(uint8 slot, uint32 const* spells)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tSPELLS:" << (uint32)slot;
     for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
         ss << ":" << spells[i];
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianArchetype(Player* player, uint8 slot, uint8 archetype)
+static void SendGuardianSpells(Player* player, uint8 slot, uint32 const* spells)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianSpells(slot, spells));
+}
+
+static std::string EncodeGuardianArchetype(uint8 slot, uint8 archetype)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tARCH:" << (uint32)slot << ":" << (uint32)archetype;
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianName(Player* player, uint8 slot, std::string const& name)
+static void SendGuardianArchetype(Player* player, uint8 slot, uint8 archetype)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianArchetype(slot, archetype));
+}
+
+static std::string EncodeGuardianName(uint8 slot, std::string const& name)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tNAME:" << (uint32)slot << ":" << name;
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianDismiss(Player* player, uint8 slot)
+static void SendGuardianName(Player* player, uint8 slot, std::string const& name)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianName(slot, name));
+}
+
+static std::string EncodeGuardianDismiss(uint8 slot)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tDISMISS:" << (uint32)slot;
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianGuid(Player* player, uint8 slot, ObjectGuid guid)
+static void SendGuardianDismiss(Player* player, uint8 slot)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianDismiss(slot));
+}
+
+static std::string EncodeGuardianGuid(uint8 slot, ObjectGuid guid)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tGUID:" << (uint32)slot << ":";
     // Format as hex matching UnitGUID("target") format: 0x0000000000000000
     ss << "0x" << std::hex << std::uppercase << std::setfill('0')
        << std::setw(16) << guid.GetRawValue();
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianPower(Player* player, uint8 slot, uint8 powerType)
+static void SendGuardianGuid(Player* player, uint8 slot, ObjectGuid guid)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianGuid(slot, guid));
+}
+
+static std::string EncodeGuardianPower(uint8 slot, uint8 powerType)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tPOWER:" << (uint32)slot << ":" << (uint32)powerType;
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianClear(Player* player, uint8 slot)
+static void SendGuardianPower(Player* player, uint8 slot, uint8 powerType)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianPower(slot, powerType));
+}
+
+static std::string EncodeGuardianClear(uint8 slot)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tCLEAR:" << (uint32)slot;
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianHealthPower(Player* player, uint8 slot, uint32 curHP, uint32 maxHP, uint32 curPow, uint32 maxPow, uint8 powType)
+static void SendGuardianClear(Player* player, uint8 slot)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianClear(slot));
+}
+
+static std::string EncodeGuardianHealthPower(uint8 slot, uint32 curHP, uint32 maxHP, uint32 curPow, uint32 maxPow, uint8 powType)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tHPOW:" << (uint32)slot
        << ":" << curHP << ":" << maxHP
        << ":" << curPow << ":" << maxPow
        << ":" << (uint32)powType;
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
 }
 
-static void SendGuardianEntry(Player* player, uint8 slot, uint32 creatureEntry)
+static void SendGuardianHealthPower(Player* player, uint8 slot, uint32 curHP, uint32 maxHP, uint32 curPow, uint32 maxPow, uint8 powType)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianHealthPower(slot, curHP, maxHP, curPow, maxPow, powType));
+}
+
+static std::string EncodeGuardianEntry(uint8 slot, uint32 creatureEntry)
 {
     std::ostringstream ss;
     ss << ADDON_PREFIX << "\tENTRY:" << (uint32)slot << ":" << creatureEntry;
-    SendCaptureAddonMessage(player, ss.str());
+    return ss.str();
+}
+
+static void SendGuardianEntry(Player* player, uint8 slot, uint32 creatureEntry)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianEntry(slot, creatureEntry));
+}
+
+static std::string EncodeGuardianVersion(uint8 slot, uint32 epoch, uint32 version)
+{
+    std::ostringstream ss;
+    ss << ADDON_PREFIX << "\tVER:" << (uint32)slot << ":" << epoch << ":" << version;
+    return ss.str();
+}
+
+// Always sent after the message(s) it versions, so the addon only records a
+// version once it holds the state that goes with it.
+static void SendGuardianVersion(Player* player, uint8 slot, uint32 epoch, uint32 version)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianVersion(slot, epoch, version));
 }
 
 // Forward declarations for data types
@@ -302,23 +973,126 @@ static void SendAllSlotsState(Player* player);
 // Data Structures
 // ============================================================================
 
-struct GuardianSlotData
+// AI state that would otherwise be lost when the creature despawns for a
+// mount, teleport or dismiss. Kept in memory only; a fresh login starts clean.
+// Remaining times are stored relative to savedAtMs so time spent unsummoned
+// still counts down.
+struct GuardianRuntimeState
 {
-    ObjectGuid guardianGuid;
-    uint32 guardianEntry    = 0;
-    uint8  guardianLevel    = 0;
-    uint32 guardianHealth   = 0;
-    uint32 guardianPower    = 0;
-    uint8  guardianPowerType = 0;
-    uint8  archetype        = ARCHETYPE_DPS;
-    uint32 spellSlots[MAX_GUARDIAN_SPELLS] = {};
-    uint32 displayId        = 0;
-    int8   equipmentId      = 0;
+    uint64 savedAtMs = 0;                               // 0 = nothing saved
+    uint32 spellIds[MAX_GUARDIAN_SPELLS]   = {};        // loadout the times below belong to
+    uint32 cooldownMs[MAX_GUARDIAN_SPELLS] = {};        // remaining spell cooldown
+    int32  auraMs[MAX_GUARDIAN_SPELLS]     = {};        // remaining self-buff, -1 = permanent, 0 = none
+    int32  tauntTimer   = 0;
+    int32  helpCryTimer = 0;
+
+    void Clear() { *this = GuardianRuntimeState(); }
+    bool IsSet() const { return savedAtMs != 0; }
+};
+
+// GuardianDerivedStats lives in CreatureCaptureAPI.h so other modules can
+// read it through GuardianView::Stats().
+using CreatureCapture::GuardianDerivedStats;
+
+// Per-spell classification bits in GuardianSpellPlan::flags.
+enum GuardianSpellPlanFlags : uint16
+{
+    SPELL_PLAN_OFFENSIVE    = 0x0001,   // hostile, usable in combat, not CC
+    SPELL_PLAN_RANGED       = 0x0002,   // max range > 5yd and not a melee ability
+    SPELL_PLAN_FREE         = 0x0004,   // no mana cost of any kind
+    SPELL_PLAN_PERIODIC     = 0x0008,   // hostile DoT / leech
+    SPELL_PLAN_CC           = 0x0010,   // stun, fear, confuse or interrupt
+    SPELL_PLAN_DEBUFF       = 0x0020,   // hostile aura without a direct damage effect
+    SPELL_PLAN_DIRECT_HEAL  = 0x0040,
+    SPELL_PLAN_HOT          = 0x0080,
+    SPELL_PLAN_SHIELD       = 0x0100,
+    SPELL_PLAN_BUFF         = 0x0200,   // helpful, not a heal
+    SPELL_PLAN_AURA         = 0x0400,   // applies at least one aura
+    SPELL_PLAN_DISPEL       = 0x0800,   // helpful dispel, type in dispelType
+    SPELL_PLAN_TAUNT        = 0x1000,
+};
+
+// Everything the guardian AI derives from a loadout by inspecting SpellInfo:
+// classification, ranges, weapon needs and the slot lists each cast routine
+// walks. Built once per loadout change and cached on the slot, so summons and
+// AI construction copy it instead of re-scanning spell effects.
+struct GuardianSpellPlan
+{
+    uint32 spellIds[MAX_GUARDIAN_SPELLS]         = {};   // loadout the plan was built for
+    uint16 flags[MAX_GUARDIAN_SPELLS]            = {};
+    float  minRange[MAX_GUARDIAN_SPELLS]         = {};   // hostile
+    float  maxRange[MAX_GUARDIAN_SPELLS]         = {};   // hostile
+    float  maxRangeFriendly[MAX_GUARDIAN_SPELLS] = {};
+    uint8  dispelType[MAX_GUARDIAN_SPELLS]       = {};
+
+    // Spell slot indices by role, in slot (priority) order
+    uint8  offensive[MAX_GUARDIAN_SPELLS] = {};
+    uint8  heals[MAX_GUARDIAN_SPELLS]     = {};
+    uint8  buffs[MAX_GUARDIAN_SPELLS]     = {};
+    uint8  offensiveCount = 0;
+    uint8  healCount      = 0;
+    uint8  buffCount      = 0;
+
+    // Stand-off distances for ranged DPS and healers
+    float  rangedPreferred = 0.0f;   // just inside the shortest ranged max range
+    float  rangedRecovery  = 0.0f;   // just past the biggest ranged min range
+
+    bool   hasTaunt          = false;
+    bool   needsRangedWeapon = false;
+    bool   needsMeleeWeapon  = false;
+    bool   built             = false;
+
+    bool IsBuiltFor(uint32 const* spells) const
+    {
+        return built && memcmp(spellIds, spells, sizeof(spellIds)) == 0;
+    }
+};
+
+// Gossip labels for one slot, rebuilt only when the inputs they were built
+// from change. Opening a menu then just copies these strings.
+struct GuardianMenuLabels
+{
+    uint32 entry       = 0;
+    uint8  slot        = 0;
+    uint8  archetype   = 0;
+    uint8  powerType   = 0;
+    bool   rangedDps   = false;
+    bool   powerChosen = false;
+    bool   built       = false;
+
+    // Tesseract menu
+    std::string summon;
+    std::string dismiss;
+    std::string release;
+
+    // Guardian gossip, indexed by archetype / power type
+    std::string archetypeSwitch[3];
+    std::string stanceMelee;
+    std::string stanceRanged;
+    std::string resourceSwitch[4];
+};
+
+struct GuardianSlotData
+{
+    ObjectGuid guardianGuid;
+    uint32 guardianEntry    = 0;
+    uint8  guardianLevel    = 0;
+    uint32 guardianHealth   = 0;
+    uint32 guardianPower    = 0;
+    uint8  guardianPowerType = 0;
+    uint8  archetype        = ARCHETYPE_DPS;
+    uint32 spellSlots[MAX_GUARDIAN_SPELLS] = {};
+    uint32 displayId        = 0;
+    int8   equipmentId      = 0;
     bool   powerChosen      = false;
     bool   rangedDps        = false;
     bool   dismissed        = false;
     bool   savedToDb        = false;
 
+    // Bumped on every change the addon mirrors (identity, spells, archetype,
+    // power, bonuses). Survives Clear() so a released slot still reads as newer.
+    uint32 version          = 0;
+
     // Bonus stats (leeched from kills + fed from items)
     // Primary stats
     int32  bonusStrength    = 0;
@@ -348,6 +1122,11 @@ struct GuardianSlotData
     int32  bonusResShadow   = 0;
     int32  bonusResArcane   = 0;
 
+    GuardianRuntimeState runtime;
+    GuardianDerivedStats derived;
+    GuardianSpellPlan    spellPlan;   // rebuilt lazily when spellSlots change
+    GuardianMenuLabels   menuLabels;  // rebuilt lazily when name/archetype/stance/resource change
+
     void Clear()
     {
         guardianGuid.Clear();
@@ -387,6 +1166,10 @@ struct GuardianSlotData
         bonusResFrost = 0;
         bonusResShadow = 0;
         bonusResArcane = 0;
+        runtime.Clear();
+        derived = GuardianDerivedStats();
+        spellPlan = GuardianSpellPlan();
+        menuLabels = GuardianMenuLabels();
     }
 
     // Clears the creature identity and resets archetype, but preserves accumulated
@@ -406,6 +1189,7 @@ struct GuardianSlotData
         rangedDps = false;
         dismissed = false;
         savedToDb = false;
+        runtime.Clear();
         // spellSlots and all bonus stats intentionally preserved
     }
 
@@ -428,14 +1212,214 @@ struct GuardianSlotData
     bool IsActive()   const { return !guardianGuid.IsEmpty(); }
 };
 
+// Creatures the owner's guardians have already tagged for loot/XP credit.
+// Lets the per-hit damage hook skip re-tagging a target it already owns.
+// Entries are only trusted while the target still has a loot recipient, so an
+// evade or respawn (both reset the tap) makes the next hit tag it again.
+// Each entry remembers which guardian slots tagged it, so one guardian's
+// evade or death only forgets the targets that guardian tagged.
+struct GuardianCreditTracker
+{
+    static constexpr size_t MAX_TRACKED = 16;
+
+    struct Entry
+    {
+        ObjectGuid guid;
+        uint8      slotMask = 0;
+    };
+
+    std::vector<Entry> credited;
+
+    bool Contains(ObjectGuid guid) const
+    {
+        return Find(guid) != credited.end();
+    }
+
+    void Add(ObjectGuid guid, uint8 slot)
+    {
+        auto itr = Find(guid);
+        if (itr == credited.end())
+        {
+            if (credited.size() >= MAX_TRACKED)
+                credited.erase(credited.begin());
+            credited.push_back({ guid, 0 });
+            itr = credited.end() - 1;
+        }
+        itr->slotMask |= uint8(1 << slot);
+    }
+
+    void Remove(ObjectGuid guid)
+    {
+        auto itr = Find(guid);
+        if (itr != credited.end())
+            credited.erase(itr);
+    }
+
+    // Forget what this slot's guardian tagged; targets another guardian
+    // also tagged stay credited
+    void ClearSlot(uint8 slot)
+    {
+        for (Entry& e : credited)
+            e.slotMask &= uint8(~(1 << slot));
+        credited.erase(std::remove_if(credited.begin(), credited.end(),
+            [](Entry const& e) { return e.slotMask == 0; }), credited.end());
+    }
+
+private:
+    std::vector<Entry>::iterator Find(ObjectGuid guid)
+    {
+        return std::find_if(credited.begin(), credited.end(), [&](Entry const& e) { return e.guid == guid; });
+    }
+
+    std::vector<Entry>::const_iterator Find(ObjectGuid guid) const
+    {
+        return std::find_if(credited.begin(), credited.end(), [&](Entry const& e) { return e.guid == guid; });
+    }
+};
+
+// Tank threat upkeep. Instead of topping up every enemy every tick, work out
+// how far the tank trails the enemy's top threat holder and inject only that
+// gap plus TankThreat.MarginPct headroom. Enemies already held with that
+// headroom are left alone, and each enemy is written at most once per
+// TankThreat.IntervalMs.
+struct GuardianThreatKeeper
+{
+    static constexpr size_t MAX_TRACKED = 16;
+    static constexpr float  MIN_THREAT  = 100.0f;   // floor so a fresh threat list still registers us
+
+    struct Entry
+    {
+        ObjectGuid guid;
+        uint64     nextMs = 0;
+    };
+
+    std::vector<Entry> entries;
+
+    // Cheapest checks first: the per-enemy interval, then whether the enemy
+    // is already on the tank. Only then is the threat list walked.
+    bool Maintain(Unit* tank, Unit* enemy, uint64 nowMs)
+    {
+        if (!enemy->CanHaveThreatList())
+            return false;
+
+        Entry* e = Find(enemy->GetGUID());
+        if (e && nowMs < e->nextMs)
+        {
+            metrics.threatRateSkips.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (enemy->GetVictim() == tank)
+        {
+            metrics.threatHeldSkips.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        ThreatMgr& mgr = enemy->GetThreatMgr();
+        float mine = mgr.GetThreat(tank);
+        float top  = 0.0f;
+        for (auto const& ref : mgr.GetThreatList())
+            if (ref->getTarget() != tank)
+                top = std::max(top, ref->GetThreat());
+
+        float wanted = std::max(top * config.tankThreatMarginPct / 100.0f, MIN_THREAT);
+        if (mine >= wanted)
+        {
+            metrics.threatHeldSkips.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (!e)
+            e = &Add(enemy->GetGUID());
+        e->nextMs = nowMs + config.tankThreatIntervalMs;
+
+        enemy->AddThreat(tank, wanted - mine);
+        metrics.threatMutations.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void Clear() { entries.clear(); }
+
+private:
+    Entry* Find(ObjectGuid guid)
+    {
+        for (Entry& e : entries)
+            if (e.guid == guid)
+                return &e;
+        return nullptr;
+    }
+
+    Entry& Add(ObjectGuid guid)
+    {
+        if (entries.size() >= MAX_TRACKED)
+            entries.erase(entries.begin());
+        entries.push_back({ guid, 0 });
+        return entries.back();
+    }
+};
+
+// Per-player coalescing for .capture feedpreview, which the addon can fire
+// many times a second. Only the latest request is served after a short delay;
+// repeats of a recent (slot, item) pair are answered from the cache. The key
+// carries the item's random property/suffix, since that changes the bonuses.
+struct FeedPreviewState
+{
+    static constexpr size_t CACHE_SIZE = 4;
+
+    struct CacheEntry
+    {
+        uint32      itemEntry  = 0;
+        int32       randomProp = 0;
+        uint8       slot       = 0;
+        uint64      expiresMs  = 0;
+        std::string payload;
+    };
+
+    uint32 pendingItem  = 0;
+    uint8  pendingSlot  = 0;
+    int32  pendingTimer = 0;
+
+    CacheEntry cache[CACHE_SIZE];
+    uint8      cacheNext = 0;
+
+    CacheEntry const* Find(uint8 slot, uint32 itemEntry, int32 randomProp, uint64 now) const
+    {
+        for (CacheEntry const& e : cache)
+            if (e.itemEntry == itemEntry && e.randomProp == randomProp && e.slot == slot && e.expiresMs > now)
+                return &e;
+        return nullptr;
+    }
+
+    void Store(uint8 slot, uint32 itemEntry, int32 randomProp, uint64 expiresMs, std::string payload)
+    {
+        CacheEntry& e = cache[cacheNext];
+        cacheNext = (cacheNext + 1) % CACHE_SIZE;
+        e.itemEntry  = itemEntry;
+        e.randomProp = randomProp;
+        e.slot       = slot;
+        e.expiresMs  = expiresMs;
+        e.payload    = std::move(payload);
+    }
+};
+
+// Slot versions live in memory only, so they restart whenever the guardian
+// state is rebuilt (login). Each rebuild gets a fresh epoch; an addon that
+// reports a different epoch is resent every slot.
+static std::atomic<uint32> s_nextGuardianEpoch{ static_cast<uint32>(time(nullptr)) };
+
 class CapturedGuardianData : public DataMap::Base
 {
 public:
     GuardianSlotData slots[MAX_GUARDIAN_SLOTS];
 
+    uint32 epoch = s_nextGuardianEpoch.fetch_add(1, std::memory_order_relaxed);
+
     ObjectGuid pendingCaptureTarget;
     uint8      pendingCaptureSlot = 0;
 
+    GuardianCreditTracker credit;
+    FeedPreviewState feedPreview;
+
     int8 FindEmptySlot() const
     {
         for (uint8 i = 0; i < config.maxSlots; ++i)
@@ -462,6 +1446,119 @@ public:
     }
 };
 
+// Guardian state is only created when a player captures or has saved slots,
+// so players who never capture carry no CapturedGuardianData at all. Paths
+// every player runs through (update, logout, teleport, gossip) look it up with
+// FindGuardianData and bail out on nullptr; GetGuardianData creates it.
+static std::string const GUARDIAN_DATA_KEY = "CapturedGuardian";
+
+static CapturedGuardianData* FindGuardianData(Player* player)
+{
+    return player->CustomData.Get<CapturedGuardianData>(GUARDIAN_DATA_KEY);
+}
+
+static CapturedGuardianData* GetGuardianData(Player* player)
+{
+    return player->CustomData.GetDefault<CapturedGuardianData>(GUARDIAN_DATA_KEY);
+}
+
+// Call after the mutation's own addon messages have gone out.
+static void BumpSlotVersion(Player* player, uint8 slot)
+{
+    CapturedGuardianData* data = FindGuardianData(player);
+    if (!data || slot >= MAX_GUARDIAN_SLOTS)
+        return;
+
+    GuardianSlotData& s = data->slots[slot];
+    ++s.version;
+    SendGuardianVersion(player, slot, data->epoch, s.version);
+}
+
+static void LogCaptureEvent(CaptureEventType type, Player* owner, uint8 slot, GuardianSlotData const& s, uint32 arg1 = 0)
+{
+    if (!config.eventLogEnabled)
+        return;
+
+    CaptureEvent ev;
+    ev.timeMs    = CaptureEventLog::NowMs();
+    ev.owner     = owner->GetGUID().GetCounter();
+    ev.entry     = s.guardianEntry;
+    ev.arg1      = arg1;
+    ev.type      = type;
+    ev.slot      = slot;
+    ev.level     = s.guardianLevel;
+    ev.archetype = s.archetype;
+    s_eventLog.Log(ev);
+}
+
+// ============================================================================
+// Public API — read-only guardian views for other modules
+// ============================================================================
+
+static_assert(CreatureCapture::MAX_SLOTS == MAX_GUARDIAN_SLOTS, "API slot count out of sync");
+static_assert(CreatureCapture::GUARDIAN_ARCHETYPE_TANK == ARCHETYPE_TANK
+    && CreatureCapture::GUARDIAN_ARCHETYPE_HEALER == ARCHETYPE_HEALER, "API archetypes out of sync");
+
+// Filled during script loading, read-only once the world runs
+static std::vector<CreatureCapture::GuardianListener*> s_guardianListeners;
+
+namespace CreatureCapture
+{
+    bool       GuardianView::IsOccupied() const  { return _slot->IsOccupied(); }
+    bool       GuardianView::IsSummoned() const  { return _slot->IsActive(); }
+    bool       GuardianView::IsDismissed() const { return _slot->dismissed; }
+    uint32     GuardianView::Entry() const       { return _slot->guardianEntry; }
+    uint8      GuardianView::Level() const       { return _slot->guardianLevel; }
+    uint8      GuardianView::Archetype() const   { return _slot->archetype; }
+    ObjectGuid GuardianView::ActiveGuid() const  { return _slot->guardianGuid; }
+    GuardianDerivedStats const& GuardianView::Stats() const { return _slot->derived; }
+
+    uint8 GetGuardians(Player* owner, GuardianView (&out)[MAX_SLOTS])
+    {
+        CapturedGuardianData* data = owner ? FindGuardianData(owner) : nullptr;
+        if (!data)
+            return 0;
+
+        uint8 count = 0;
+        for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
+            if (data->slots[i].IsOccupied())
+                out[count++] = GuardianView(&data->slots[i], i);
+        return count;
+    }
+
+    GuardianView GetGuardian(Player* owner, uint8 slot)
+    {
+        CapturedGuardianData* data = owner ? FindGuardianData(owner) : nullptr;
+        if (!data || slot >= MAX_GUARDIAN_SLOTS)
+            return GuardianView();
+        return GuardianView(&data->slots[slot], slot);
+    }
+
+    void AddGuardianListener(GuardianListener* listener)
+    {
+        if (listener)
+            s_guardianListeners.push_back(listener);
+    }
+}
+
+static void NotifyGuardianCaptured(Player* owner, uint8 slot, GuardianSlotData const& s)
+{
+    for (CreatureCapture::GuardianListener* listener : s_guardianListeners)
+        listener->OnGuardianCaptured(owner, CreatureCapture::GuardianView(&s, slot));
+}
+
+static void NotifyGuardianReleased(Player* owner, uint8 slot, GuardianSlotData const& s, bool progressKept)
+{
+    for (CreatureCapture::GuardianListener* listener : s_guardianListeners)
+        listener->OnGuardianReleased(owner, CreatureCapture::GuardianView(&s, slot), progressKept);
+}
+
+static void NotifyGuardianLevelChanged(Player* owner, uint8 slot, GuardianSlotData const& s, uint8 oldLevel)
+{
+    for (CreatureCapture::GuardianListener* listener : s_guardianListeners)
+        listener->OnGuardianLevelChanged(owner, CreatureCapture::GuardianView(&s, slot), oldLevel);
+}
+
 // ============================================================================
 // Derived Stat Helpers — convert raw stat accumulators into combat values
 // ============================================================================
@@ -473,179 +1570,1488 @@ static constexpr float PARRY_RATING_PER_PCT   = 49.18f;
 static constexpr float HASTE_RATING_PER_PCT   = 32.79f;
 static constexpr float BLOCK_RATING_PER_PCT   = 16.39f;
 
+// Per-stat formulas on float inputs. The scalar helpers below and the
+// GuardianStatBatch kernel both go through these, so the two paths cannot
+// drift; negative totals clamp to 0 for the unsigned pools.
+static inline float HealthFromStamina(float stamina)             { return stamina * 10.0f; }
+static inline float ManaFromIntellect(float intellect)           { return intellect * 15.0f; }
+static inline float MeleeAPFromStats(float strength, float ap)   { return strength * 2.0f + ap; }
+static inline float RangedAPFromStats(float agility, float ap)   { return agility + ap; }
+static inline float SpellPowerFromStats(float intellect, float sp) { return intellect + sp; }
+static inline float RatingToPct(float rating, float perPct)      { return rating / perPct; }
+static inline float CritPctFromStats(float agility, float rating)
+{
+    return agility / 62.5f + RatingToPct(rating, CRIT_RATING_PER_PCT);
+}
+static inline uint32 ClampPool(float value)                      { return uint32(std::max(value, 0.0f)); }
+
 static float GetBonusMeleeAP(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusStrength * 2 + s.bonusAttackPower);
+    return MeleeAPFromStats(float(s.bonusStrength), float(s.bonusAttackPower));
 }
 
 static float GetBonusRangedAP(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusAgility + s.bonusAttackPower);
+    return RangedAPFromStats(float(s.bonusAgility), float(s.bonusAttackPower));
 }
 
 static float GetBonusSpellPower(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusIntellect + s.bonusSpellPower);
+    return SpellPowerFromStats(float(s.bonusIntellect), float(s.bonusSpellPower));
 }
 
 static uint32 GetBonusHealth(GuardianSlotData const& s)
 {
-    return static_cast<uint32>(s.bonusStamina * 10);
+    return ClampPool(HealthFromStamina(float(s.bonusStamina)));
 }
 
 static uint32 GetBonusMana(GuardianSlotData const& s)
 {
-    return static_cast<uint32>(s.bonusIntellect * 15);
+    return ClampPool(ManaFromIntellect(float(s.bonusIntellect)));
 }
 
 static float GetBonusCritPct(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusAgility) / 62.5f +
-           static_cast<float>(s.bonusCritRating) / CRIT_RATING_PER_PCT;
+    return CritPctFromStats(float(s.bonusAgility), float(s.bonusCritRating));
 }
 
 static float GetBonusDodgePct(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusDodgeRating) / DODGE_RATING_PER_PCT;
+    return RatingToPct(float(s.bonusDodgeRating), DODGE_RATING_PER_PCT);
 }
 
 static float GetBonusParryPct(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusParryRating) / PARRY_RATING_PER_PCT;
+    return RatingToPct(float(s.bonusParryRating), PARRY_RATING_PER_PCT);
 }
 
 static float GetBonusHastePct(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusHasteRating) / HASTE_RATING_PER_PCT;
+    return RatingToPct(float(s.bonusHasteRating), HASTE_RATING_PER_PCT);
 }
 
 static float GetBonusBlockPct(GuardianSlotData const& s)
 {
-    return static_cast<float>(s.bonusBlockRating) / BLOCK_RATING_PER_PCT;
+    return RatingToPct(float(s.bonusBlockRating), BLOCK_RATING_PER_PCT);
+}
+
+// Scalar path for a single slot.
+static void RefreshDerivedStats(GuardianSlotData& s)
+{
+    GuardianDerivedStats& d = s.derived;
+    d.health     = GetBonusHealth(s);
+    d.mana       = GetBonusMana(s);
+    d.meleeAP    = GetBonusMeleeAP(s);
+    d.rangedAP   = GetBonusRangedAP(s);
+    d.spellPower = GetBonusSpellPower(s);
+    d.critPct    = GetBonusCritPct(s);
+    d.dodgePct   = GetBonusDodgePct(s);
+    d.parryPct   = GetBonusParryPct(s);
+    d.blockPct   = GetBonusBlockPct(s);
+    d.hastePct   = GetBonusHastePct(s);
 }
 
+// ============================================================================
+// Derived Stat Batch — recompute many guardians at once
+// ============================================================================
+
+// Raw stat blocks in structure-of-arrays form. Each pass in Compute() is a
+// branch-free loop over contiguous float arrays, which GCC/Clang/MSVC
+// auto-vectorize at the optimization levels the core builds with, so the
+// kernel stays portable without hand-written intrinsics. The passes use the
+// same inline formulas as the scalar helpers.
+struct GuardianStatBatch
+{
+    size_t count = 0;
+
+    // Inputs
+    std::vector<float> strength, agility, intellect, stamina;
+    std::vector<float> attackPower, spellPower;
+    std::vector<float> critRating, dodgeRating, parryRating, hasteRating, blockRating;
+
+    // Outputs
+    std::vector<float> outHealth, outMana, outMeleeAP, outRangedAP, outSpellPower;
+    std::vector<float> outCrit, outDodge, outParry, outBlock, outHaste;
+
+    void Resize(size_t n)
+    {
+        count = n;
+        for (std::vector<float>* v : { &strength, &agility, &intellect, &stamina, &attackPower, &spellPower,
+                                       &critRating, &dodgeRating, &parryRating, &hasteRating, &blockRating,
+                                       &outHealth, &outMana, &outMeleeAP, &outRangedAP, &outSpellPower,
+                                       &outCrit, &outDodge, &outParry, &outBlock, &outHaste })
+            v->resize(n);
+    }
+
+    void Load(size_t i, GuardianSlotData const& s)
+    {
+        strength[i]    = float(s.bonusStrength);
+        agility[i]     = float(s.bonusAgility);
+        intellect[i]   = float(s.bonusIntellect);
+        stamina[i]     = float(s.bonusStamina);
+        attackPower[i] = float(s.bonusAttackPower);
+        spellPower[i]  = float(s.bonusSpellPower);
+        critRating[i]  = float(s.bonusCritRating);
+        dodgeRating[i] = float(s.bonusDodgeRating);
+        parryRating[i] = float(s.bonusParryRating);
+        hasteRating[i] = float(s.bonusHasteRating);
+        blockRating[i] = float(s.bonusBlockRating);
+    }
+
+    void Compute()
+    {
+        size_t const n = count;
+        float const* __restrict str = strength.data();
+        float const* __restrict agi = agility.data();
+        float const* __restrict in  = intellect.data();
+        float const* __restrict sta = stamina.data();
+        float const* __restrict ap  = attackPower.data();
+        float const* __restrict sp  = spellPower.data();
+
+        float* __restrict hp    = outHealth.data();
+        float* __restrict mana  = outMana.data();
+        float* __restrict mAP   = outMeleeAP.data();
+        float* __restrict rAP   = outRangedAP.data();
+        float* __restrict spOut = outSpellPower.data();
+
+        for (size_t i = 0; i < n; ++i) hp[i]    = HealthFromStamina(sta[i]);
+        for (size_t i = 0; i < n; ++i) mana[i]  = ManaFromIntellect(in[i]);
+        for (size_t i = 0; i < n; ++i) mAP[i]   = MeleeAPFromStats(str[i], ap[i]);
+        for (size_t i = 0; i < n; ++i) rAP[i]   = RangedAPFromStats(agi[i], ap[i]);
+        for (size_t i = 0; i < n; ++i) spOut[i] = SpellPowerFromStats(in[i], sp[i]);
+
+        float const* __restrict critR = critRating.data();
+        float* __restrict crit = outCrit.data();
+        for (size_t i = 0; i < n; ++i) crit[i] = CritPctFromStats(agi[i], critR[i]);
+
+        RatingPass(outDodge.data(), dodgeRating.data(), DODGE_RATING_PER_PCT);
+        RatingPass(outParry.data(), parryRating.data(), PARRY_RATING_PER_PCT);
+        RatingPass(outBlock.data(), blockRating.data(), BLOCK_RATING_PER_PCT);
+        RatingPass(outHaste.data(), hasteRating.data(), HASTE_RATING_PER_PCT);
+    }
+
+    void Store(size_t i, GuardianDerivedStats& d) const
+    {
+        d.health     = ClampPool(outHealth[i]);
+        d.mana       = ClampPool(outMana[i]);
+        d.meleeAP    = outMeleeAP[i];
+        d.rangedAP   = outRangedAP[i];
+        d.spellPower = outSpellPower[i];
+        d.critPct    = outCrit[i];
+        d.dodgePct   = outDodge[i];
+        d.parryPct   = outParry[i];
+        d.blockPct   = outBlock[i];
+        d.hastePct   = outHaste[i];
+    }
+
+private:
+    void RatingPass(float* __restrict out, float const* __restrict rating, float perPct) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = RatingToPct(rating[i], perPct);
+    }
+};
+
 // bonusBlockValue is tracked for display and DB persistence.
 // Creature's native GetShieldBlockValue() = level/2 + str/20;
 // bonusStrength flows into that formula naturally.
 // bonusBlockValue (from shield Block field) is not injectable without
 // a core patch, but is shown in .capture info and the addon tooltip.
 
-// Forward declarations for functions used by CapturedGuardianAI
-static void SaveGuardianSlotToDb(Player* player, GuardianSlotData* slotData, uint8 slotIndex);
-static void TryLeechFromKill(Player* owner, Creature* killed);
-
 // ============================================================================
-// CapturedGuardianAI — Archetype-driven combat AI
+// Spell Bonus Coefficients — per-spell spell power scaling for guardian casts
 // ============================================================================
 
-class CapturedGuardianAI : public CreatureAI
+// Indexed directly by spell ID and built once at startup, so the damage hooks
+// do a bounds check and an array read instead of a flat guess per hit.
+// direct: fraction of bonus spell power added to each direct hit.
+// dot:    fraction added to each periodic tick.
+struct GuardianSpellCoefficient
 {
-public:
-    explicit CapturedGuardianAI(Creature* creature, uint8 archetype, uint32 const* spells, uint8 slotIndex, bool rangedDps = false)
-        : CreatureAI(creature),
-        _owner(nullptr),
-        _archetype(archetype),
-        _slotIndex(slotIndex),
-        _rangedDps(rangedDps),
-        _preferredRange(0.0f),
-        _recoveryRange(0.0f),
-        _updateTimer(1000),
-        _combatCheckTimer(500),
-        _regenTimer(2000)
-    {
-        if (spells)
-            memcpy(_spellSlots, spells, sizeof(_spellSlots));
-        else
-            memset(_spellSlots, 0, sizeof(_spellSlots));
+    float direct = 0.0f;
+    float dot    = 0.0f;
+};
 
-        // Detect if any taught spell is a taunt
-        _hasTauntSpell = false;
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
-        {
-            if (_spellSlots[i])
-            {
-                SpellInfo const* si = sSpellMgr->GetSpellInfo(_spellSlots[i]);
-                if (si && si->HasAura(SPELL_AURA_MOD_TAUNT))
-                {
-                    _hasTauntSpell = true;
-                    break;
-                }
-            }
-        }
+static std::vector<GuardianSpellCoefficient> s_spellCoefficients;
 
-        RecalcPreferredRange();
+// What GetSpellCoefficient reads: s_spellCoefficients, or the mapped table
+// cache when it was loaded from disk
+static GuardianSpellCoefficient const* s_spellCoefficientTable = nullptr;
+static uint32 s_spellCoefficientCount = 0;
 
-        // Equip fallback weapons for any spells that need them (e.g. Shoot needs a bow)
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
-            if (_spellSlots[i])
-                EquipFallbackWeaponForSpell(_spellSlots[i]);
+// Used for spells outside the table (no SpellInfo, or table not built yet)
+static constexpr GuardianSpellCoefficient DEFAULT_SPELL_COEFFICIENT = { 0.3f, 0.1f };
 
-        if (ObjectGuid ownerGuid = me->GetOwnerGUID())
-            _owner = ObjectAccessor::GetPlayer(*me, ownerGuid);
-    }
+// Same shape as the core's default: cast time / 3.5s for direct damage,
+// duration / 15s spread over the ticks for DoTs, split between the two for
+// hybrid spells, halved for area spells. Physical spells scale with AP, not SP.
+static GuardianSpellCoefficient CalculateRuleCoefficient(SpellInfo const* spellInfo)
+{
+    GuardianSpellCoefficient coef;
+    if (spellInfo->DmgClass == SPELL_DAMAGE_CLASS_MELEE || spellInfo->DmgClass == SPELL_DAMAGE_CLASS_RANGED)
+        return coef;
 
-    float GetFollowDist() const
+    bool hasDirect = false;
+    bool hasDot    = false;
+    for (uint8 eff = 0; eff < MAX_SPELL_EFFECTS; ++eff)
     {
-        return GUARDIAN_FOLLOW_DIST;
+        SpellEffectInfo const& effect = spellInfo->Effects[eff];
+        if (effect.Effect == SPELL_EFFECT_SCHOOL_DAMAGE)
+            hasDirect = true;
+        else if (effect.Effect == SPELL_EFFECT_APPLY_AURA &&
+                 (effect.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE ||
+                  effect.ApplyAuraName == SPELL_AURA_PERIODIC_LEECH))
+            hasDot = true;
     }
 
-    float GetFollowAngle() const
+    int32 duration = spellInfo->GetMaxDuration();
+    int32 castTime = spellInfo->IsChanneled() ? duration : spellInfo->CalcCastTime();
+    castTime = std::min(std::max(castTime, 1500), 7000);
+
+    float directPart = castTime / 3500.0f;
+    float dotPart    = (duration > 0 && !spellInfo->IsChanneled()) ? duration / 15000.0f : directPart;
+
+    if (hasDirect && hasDot)
     {
-        return GUARDIAN_FOLLOW_ANGLES[_slotIndex % MAX_GUARDIAN_SLOTS];
+        float dotShare = dotPart / (dotPart + directPart);
+        directPart *= 1.0f - dotShare;
+        dotPart    *= dotShare;
     }
 
-    void SetArchetype(uint8 arch)
+    float areaScale = spellInfo->IsAffectingArea() ? 0.5f : 1.0f;
+
+    if (hasDirect)
+        coef.direct = directPart * areaScale;
+    if (hasDot)
     {
-        _archetype = arch;
-        RecalcPreferredRange();
-        if (_owner && !me->GetVictim())
-        {
-            me->GetMotionMaster()->Clear();
-            me->GetMotionMaster()->MoveFollow(_owner, GetFollowDist(), GetFollowAngle());
-        }
+        uint32 ticks = spellInfo->GetMaxTicks();
+        coef.dot = dotPart * areaScale / float(ticks ? ticks : 1);
     }
+    return coef;
+}
 
-    uint8 GetArchetype() const { return _archetype; }
-    uint8 GetSlotIndex() const { return _slotIndex; }
-    bool  IsRangedDps()  const { return _rangedDps; }
+// spell_bonus_data (already loaded by SpellMgr, ranks resolved) wins where it
+// has a value; a negative column means "unset" and falls back to the rules.
+static void BuildSpellCoefficientTable()
+{
+    uint32 storeSize = sSpellMgr->GetSpellInfoStoreSize();
+    s_spellCoefficients.assign(storeSize, GuardianSpellCoefficient());
 
-    void SetRangedDps(bool ranged)
+    uint32 fromDb = 0;
+    for (uint32 spellId = 1; spellId < storeSize; ++spellId)
     {
-        _rangedDps = ranged;
-        RecalcPreferredRange();
-        if (_owner && !me->GetVictim())
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+        if (!spellInfo)
+            continue;
+
+        GuardianSpellCoefficient coef = CalculateRuleCoefficient(spellInfo);
+        if (SpellBonusEntry const* bonus = sSpellMgr->GetSpellBonusData(spellId))
         {
-            me->GetMotionMaster()->Clear();
-            me->GetMotionMaster()->MoveFollow(_owner, GetFollowDist(), GetFollowAngle());
+            if (bonus->direct_damage >= 0.0f)
+                coef.direct = bonus->direct_damage;
+            if (bonus->dot_damage >= 0.0f)
+                coef.dot = bonus->dot_damage;
+            ++fromDb;
         }
+        s_spellCoefficients[spellId] = coef;
     }
 
-    void SetSpell(uint32 slot, uint32 spellId)
-    {
-        if (slot < MAX_GUARDIAN_SPELLS)
-            _spellSlots[slot] = spellId;
+    s_spellCoefficientTable = s_spellCoefficients.data();
+    s_spellCoefficientCount = storeSize;
 
-        if (spellId)
-            EquipFallbackWeaponForSpell(spellId);
+    LOG_INFO("module", "mod-creature-capture: built spell coefficients for {} spells ({} from spell_bonus_data)",
+        storeSize, fromDb);
+}
 
-        // Re-scan for taunt spells
-        _hasTauntSpell = false;
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
-        {
-            if (_spellSlots[i])
+static GuardianSpellCoefficient const& GetSpellCoefficient(SpellInfo const* spellInfo)
+{
+    if (spellInfo && spellInfo->Id < s_spellCoefficientCount)
+        return s_spellCoefficientTable[spellInfo->Id];
+    return DEFAULT_SPELL_COEFFICIENT;
+}
+
+// ============================================================================
+// Startup Table Cache — world-derived tables mapped from disk
+// ============================================================================
+
+// The spell coefficient table and the per-creature SmartAI cast lists depend
+// only on world data, so they are written to TableCache.File and mapped
+// read-only on the next start while the file's key still matches. The key
+// hashes CHECKSUM TABLE of the source world tables, the spell store size, the
+// core revision and TABLE_CACHE_FORMAT. A key mismatch, bad checksum or I/O
+// error rebuilds from world data and rewrites the file.
+//
+// Layout (host byte order; offsets from file start so it maps anywhere):
+//   TableCacheHeader
+//   GuardianSpellCoefficient[coefCount]     indexed by spell ID
+//   SmartSpellIndex[smartEntryCount]        sorted by creature entry
+//   uint32[smartSpellCount]                 spell IDs, grouped by entry
+static constexpr uint32 TABLE_CACHE_FORMAT = 1;   // bump when layout or derivation changes
+static constexpr char   TABLE_CACHE_MAGIC[8] = { 'C', 'C', 'A', 'P', 'T', 'B', 'L', 'S' };
+
+struct TableCacheHeader
+{
+    char   magic[8];
+    uint32 format;
+    uint32 headerSize;
+    uint64 key;
+    uint64 checksum;            // FNV-1a over everything after the header
+    uint32 coefCount;
+    uint32 coefOffset;
+    uint32 smartEntryCount;
+    uint32 smartIndexOffset;
+    uint32 smartSpellCount;
+    uint32 smartSpellOffset;
+};
+
+struct SmartSpellIndex
+{
+    uint32 entry;
+    uint32 first;
+    uint32 count;
+};
+
+static_assert(sizeof(GuardianSpellCoefficient) == 8, "table cache layout");
+static_assert(sizeof(SmartSpellIndex) == 12, "table cache layout");
+static_assert(sizeof(TableCacheHeader) % 8 == 0, "table cache layout");
+
+static uint64 Fnv1a64(void const* data, size_t size, uint64 hash = 14695981039346656037ull)
+{
+    uint8 const* p = static_cast<uint8 const*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= p[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+class GuardianTableCache
+{
+public:
+    ~GuardianTableCache() { Unmap(); }
+
+    void LoadOrBuild()
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto ElapsedMs = [&] { return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count(); };
+
+        std::string path;
+        uint64 key = 0;
+        if (config.tableCacheEnabled)
+        {
+            path = ResolvePath();
+            key  = ComputeKey();
+            if (Map(path, key))
             {
-                SpellInfo const* si = sSpellMgr->GetSpellInfo(_spellSlots[i]);
-                if (si && si->HasAura(SPELL_AURA_MOD_TAUNT))
-                {
-                    _hasTauntSpell = true;
-                    break;
-                }
+                LOG_INFO("module", "mod-creature-capture: mapped {} spell coefficients and {} SmartAI cast lists from '{}' in {} ms",
+                    s_spellCoefficientCount, _smartEntryCount, path, ElapsedMs());
+                return;
+            }
+        }
+
+        BuildSpellCoefficientTable();
+        BuildSmartSpells();
+        if (config.tableCacheEnabled)
+            Write(path, key);
+
+        LOG_INFO("module", "mod-creature-capture: built startup tables from world data in {} ms", ElapsedMs());
+    }
+
+    // The tables are a snapshot of world data, so .reload smart_scripts and
+    // .reload spell_bonus_data do not reach them; .capture reload tables asks
+    // for a rebuild, which Update() runs on the world thread while no map is
+    // reading them, and rewrites the cache file.
+    void RequestRebuild() { _rebuildRequested.store(true, std::memory_order_relaxed); }
+
+    void Update()
+    {
+        if (!_rebuildRequested.exchange(false, std::memory_order_relaxed))
+            return;
+
+        Unmap();
+        BuildSpellCoefficientTable();
+        BuildSmartSpells();
+        if (config.tableCacheEnabled)
+            Write(ResolvePath(), ComputeKey());
+        LOG_INFO("module", "mod-creature-capture: rebuilt startup tables from world data");
+    }
+
+    // SmartAI cast/self-cast spells for a creature entry. False if the lists
+    // were never built, in which case the caller queries smart_scripts itself.
+    bool GetSmartSpells(uint32 entry, std::set<uint32>& out) const
+    {
+        if (!_smartIndex)
+            return false;
+
+        SmartSpellIndex const* end = _smartIndex + _smartEntryCount;
+        SmartSpellIndex const* itr = std::lower_bound(_smartIndex, end, entry,
+            [](SmartSpellIndex const& e, uint32 value) { return e.entry < value; });
+        if (itr != end && itr->entry == entry)
+            out.insert(_smartSpells + itr->first, _smartSpells + itr->first + itr->count);
+        return true;
+    }
+
+private:
+    static std::string ResolvePath()
+    {
+        std::string path = config.tableCacheFile;
+        if (!path.empty() && path[0] != '/')
+        {
+            std::string dataDir = sConfigMgr->GetOption<std::string>("DataDir", "");
+            if (!dataDir.empty() && dataDir.back() != '/' && dataDir.back() != '\\')
+                dataDir += '/';
+            path = dataDir + path;
+        }
+        return path;
+    }
+
+    static uint64 ComputeKey()
+    {
+        uint64 key = Fnv1a64(&TABLE_CACHE_FORMAT, sizeof(TABLE_CACHE_FORMAT));
+
+        uint32 storeSize = sSpellMgr->GetSpellInfoStoreSize();
+        key = Fnv1a64(&storeSize, sizeof(storeSize), key);
+
+        // Edited DBC files keep the store size; their size and mtime don't
+        std::string dataDir = sConfigMgr->GetOption<std::string>("DataDir", "./");
+        std::filesystem::path dbc = std::filesystem::path(dataDir) / "dbc" / "Spell.dbc";
+        std::error_code ec;
+        uint64 dbcSize = std::filesystem::file_size(dbc, ec);
+        if (ec)
+            dbcSize = 0;
+        int64 dbcTime = std::filesystem::last_write_time(dbc, ec).time_since_epoch().count();
+        if (ec)
+            dbcTime = 0;
+        key = Fnv1a64(&dbcSize, sizeof(dbcSize), key);
+        key = Fnv1a64(&dbcTime, sizeof(dbcTime), key);
+
+        char const* revision = GitRevision::GetHash();
+        key = Fnv1a64(revision, std::strlen(revision), key);
+
+        if (QueryResult result = WorldDatabase.Query("CHECKSUM TABLE smart_scripts, spell_bonus_data, spell_dbc"))
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+                std::string table = fields[0].Get<std::string>();
+                uint64 checksum = fields[1].IsNull() ? 0 : fields[1].Get<uint64>();
+                key = Fnv1a64(table.data(), table.size(), key);
+                key = Fnv1a64(&checksum, sizeof(checksum), key);
+            }
+            while (result->NextRow());
+        }
+        return key;
+    }
+
+    bool Map(std::string const& path, uint64 key)
+    {
+#ifdef _WIN32
+        // No mmap: read the file into memory, same validation and views
+        FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file)
+            return false;
+        std::fseek(file, 0, SEEK_END);
+        long size = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        if (size <= 0)
+        {
+            std::fclose(file);
+            return false;
+        }
+        _owned.resize(size_t(size));
+        size_t read = std::fread(_owned.data(), 1, _owned.size(), file);
+        std::fclose(file);
+        if (read != _owned.size())
+        {
+            _owned.clear();
+            return false;
+        }
+        _data = _owned.data();
+        _size = _owned.size();
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            close(fd);
+            return false;
+        }
+        void* addr = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED)
+            return false;
+        _data = static_cast<char const*>(addr);
+        _size = size_t(st.st_size);
+        _mapped = true;
+#endif
+
+        if (!Validate(key))
+        {
+            LOG_INFO("module", "mod-creature-capture: table cache '{}' is stale or damaged, rebuilding", path);
+            Unmap();
+            return false;
+        }
+
+        TableCacheHeader const* header = reinterpret_cast<TableCacheHeader const*>(_data);
+        s_spellCoefficientTable = reinterpret_cast<GuardianSpellCoefficient const*>(_data + header->coefOffset);
+        s_spellCoefficientCount = header->coefCount;
+        _smartIndex      = reinterpret_cast<SmartSpellIndex const*>(_data + header->smartIndexOffset);
+        _smartEntryCount = header->smartEntryCount;
+        _smartSpells     = reinterpret_cast<uint32 const*>(_data + header->smartSpellOffset);
+        return true;
+    }
+
+    bool Validate(uint64 key) const
+    {
+        if (_size < sizeof(TableCacheHeader))
+            return false;
+
+        TableCacheHeader const* header = reinterpret_cast<TableCacheHeader const*>(_data);
+        if (std::memcmp(header->magic, TABLE_CACHE_MAGIC, sizeof(TABLE_CACHE_MAGIC)) != 0
+            || header->format != TABLE_CACHE_FORMAT || header->headerSize != sizeof(TableCacheHeader)
+            || header->key != key)
+            return false;
+
+        auto InBounds = [&](uint32 offset, uint32 count, size_t elemSize)
+        {
+            return offset >= sizeof(TableCacheHeader) && offset % 4 == 0
+                && uint64(offset) + uint64(count) * elemSize <= _size;
+        };
+        if (!InBounds(header->coefOffset, header->coefCount, sizeof(GuardianSpellCoefficient))
+            || !InBounds(header->smartIndexOffset, header->smartEntryCount, sizeof(SmartSpellIndex))
+            || !InBounds(header->smartSpellOffset, header->smartSpellCount, sizeof(uint32)))
+            return false;
+
+        SmartSpellIndex const* index = reinterpret_cast<SmartSpellIndex const*>(_data + header->smartIndexOffset);
+        for (uint32 i = 0; i < header->smartEntryCount; ++i)
+            if (uint64(index[i].first) + index[i].count > header->smartSpellCount)
+                return false;
+
+        return Fnv1a64(_data + sizeof(TableCacheHeader), _size - sizeof(TableCacheHeader)) == header->checksum;
+    }
+
+    void Unmap()
+    {
+#ifdef _WIN32
+        _owned.clear();
+        _owned.shrink_to_fit();
+#else
+        if (_mapped)
+            munmap(const_cast<char*>(_data), _size);
+        _mapped = false;
+#endif
+        _data = nullptr;
+        _size = 0;
+        _smartIndex = nullptr;
+        _smartSpells = nullptr;
+        _smartEntryCount = 0;
+    }
+
+    // One query for every creature's cast list instead of one per capture
+    void BuildSmartSpells()
+    {
+        _builtIndex.clear();
+        _builtSpells.clear();
+
+        // action_type 11 = SMART_ACTION_CAST, 85 = SMART_ACTION_SELF_CAST
+        QueryResult result = WorldDatabase.Query(
+            "SELECT DISTINCT entryorguid, action_param1 FROM smart_scripts "
+            "WHERE source_type = 0 AND entryorguid > 0 "
+            "AND action_type IN (11, 85) AND action_param1 != 0 "
+            "ORDER BY entryorguid, action_param1");
+        if (result)
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+                uint32 entry   = fields[0].Get<uint32>();
+                uint32 spellId = fields[1].Get<uint32>();
+                if (_builtIndex.empty() || _builtIndex.back().entry != entry)
+                    _builtIndex.push_back({ entry, uint32(_builtSpells.size()), 0 });
+                _builtSpells.push_back(spellId);
+                ++_builtIndex.back().count;
+            }
+            while (result->NextRow());
+        }
+
+        _smartIndex      = _builtIndex.data();
+        _smartEntryCount = uint32(_builtIndex.size());
+        _smartSpells     = _builtSpells.data();
+    }
+
+    // Written to a temporary file and renamed, so a crash mid-write never
+    // leaves a half file under the real name
+    void Write(std::string const& path, uint64 key) const
+    {
+        TableCacheHeader header = {};
+        std::memcpy(header.magic, TABLE_CACHE_MAGIC, sizeof(TABLE_CACHE_MAGIC));
+        header.format     = TABLE_CACHE_FORMAT;
+        header.headerSize = sizeof(TableCacheHeader);
+        header.key        = key;
+
+        std::string payload;
+        auto Append = [&](void const* data, size_t size)
+        {
+            uint32 offset = uint32(sizeof(TableCacheHeader) + payload.size());
+            payload.append(static_cast<char const*>(data), size);
+            return offset;
+        };
+
+        header.coefCount        = s_spellCoefficientCount;
+        header.coefOffset       = Append(s_spellCoefficientTable, s_spellCoefficientCount * sizeof(GuardianSpellCoefficient));
+        header.smartEntryCount  = uint32(_builtIndex.size());
+        header.smartIndexOffset = Append(_builtIndex.data(), _builtIndex.size() * sizeof(SmartSpellIndex));
+        header.smartSpellCount  = uint32(_builtSpells.size());
+        header.smartSpellOffset = Append(_builtSpells.data(), _builtSpells.size() * sizeof(uint32));
+        header.checksum         = Fnv1a64(payload.data(), payload.size());
+
+        std::string tmpPath = path + ".tmp";
+        FILE* file = std::fopen(tmpPath.c_str(), "wb");
+        if (!file)
+        {
+            LOG_ERROR("module", "mod-creature-capture: cannot write table cache '{}'", tmpPath);
+            return;
+        }
+        bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1
+            && std::fwrite(payload.data(), 1, payload.size(), file) == payload.size();
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        {
+            LOG_ERROR("module", "mod-creature-capture: cannot write table cache '{}'", path);
+            std::remove(tmpPath.c_str());
+        }
+    }
+
+    char const* _data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    std::vector<char> _owned;
+#else
+    bool _mapped = false;
+#endif
+
+    SmartSpellIndex const* _smartIndex = nullptr;
+    uint32 const* _smartSpells = nullptr;
+    uint32 _smartEntryCount = 0;
+
+    // Backing storage when built from world data rather than mapped
+    std::vector<SmartSpellIndex> _builtIndex;
+    std::vector<uint32> _builtSpells;
+
+    std::atomic<bool> _rebuildRequested{ false };
+};
+
+static GuardianTableCache s_tableCache;
+
+// Forward declarations for functions used by CapturedGuardianAI
+static void SaveGuardianSlotToDb(Player* player, GuardianSlotData* slotData, uint8 slotIndex);
+static void TryLeechFromKill(Player* owner, Creature* killed);
+static bool IsGuardianLoginPending(Player* player);
+
+// ============================================================================
+// Guardian Decisions — snapshot / decide / apply
+// ============================================================================
+
+// Every guardian's spell and threat choices are split in three. The snapshot
+// reads everything a choice depends on (allies and their health, the victim,
+// casting enemies, enemies on allies, per-spell range, aura and dispel bits,
+// cooldowns, power) on the map thread. DecideGuardian is a pure function of
+// the snapshot, so it can run anywhere. Applying re-checks what may have
+// changed since (target alive, cooldown, range, power, LOS) and casts, again
+// on the map thread. Serially the three steps run back to back; with
+// ParallelAI the decide step runs on a worker pool between map updates.
+//
+// The heal pass is the healer's first step and keeps its own scoring below.
+
+enum HealKind : uint8
+{
+    HEAL_KIND_NONE   = 0,
+    HEAL_KIND_DIRECT = 1,   // HEAL / HEAL_PCT / HEAL_MAX_HEALTH
+    HEAL_KIND_HOT    = 2,   // PERIODIC_HEAL aura, amount summed over all ticks
+    HEAL_KIND_SHIELD = 3    // SCHOOL_ABSORB aura
+};
+
+struct HealEstimate
+{
+    uint8  kind       = HEAL_KIND_NONE;
+    bool   leavesAura = false;   // any HoT/absorb effect, even on a DIRECT heal; skipped while ours is up
+    uint8  powerType  = POWER_MANA;
+    float  amount     = 0.0f;    // flat health restored or absorbed
+    float  pct        = 0.0f;    // % of target max health
+    uint32 castTime   = 0;       // ms, never below the 1.5s GCD
+    uint32 cost       = 0;
+};
+
+struct HealCandidate
+{
+    ObjectGuid guid;
+    uint32 health     = 0;
+    uint32 maxHealth  = 0;
+    uint8  inRange    = 0;   // bit per spell slot
+    uint8  hasOwnAura = 0;   // bit per spell slot: our HoT/shield already on it
+};
+
+// The heal pass runs three phases, each on at most one target:
+// owner below 25% (shields first), lowest tank below 70%, lowest ally below
+// the in/out-of-combat threshold.
+enum HealPhase : uint8
+{
+    HEAL_PHASE_OWNER = 0,
+    HEAL_PHASE_TANK  = 1,
+    HEAL_PHASE_ANY   = 2,
+    MAX_HEAL_PHASES
+};
+
+struct HealSnapshot
+{
+    uint32       spellIds[MAX_GUARDIAN_SPELLS] = {};
+    HealEstimate estimates[MAX_GUARDIAN_SPELLS];
+    uint32       power[MAX_GUARDIAN_SPELLS] = {};   // current power of each spell's type
+    uint8        ready = 0;                          // bit per slot: off cooldown
+    HealCandidate candidates[MAX_HEAL_PHASES];
+    int8         phaseTarget[MAX_HEAL_PHASES] = { -1, -1, -1 };
+    uint8        candidateCount = 0;
+};
+
+struct HealChoice
+{
+    ObjectGuid target;
+    uint8      slot = 0;
+};
+
+// Ordered fallbacks: the applier casts the first one still valid
+struct HealDecision
+{
+    static constexpr uint8 MAX_CHOICES = MAX_HEAL_PHASES + 1;   // owner phase has two passes
+
+    HealChoice choices[MAX_CHOICES];
+    uint8      count = 0;
+};
+
+static int8 PickHealSpell(HealSnapshot const& snap, HealCandidate const& c, bool shieldsFirst, int pass)
+{
+    float deficit = float(c.maxHealth - c.health);
+    int8  best = -1;
+    float bestScore = 0.0f;
+
+    for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+    {
+        if (!snap.spellIds[i])
+            continue;
+
+        HealEstimate const& est = snap.estimates[i];
+        if (est.kind == HEAL_KIND_NONE)
+            continue;
+
+        bool isShield = est.kind == HEAL_KIND_SHIELD;
+        if (shieldsFirst && pass == 0 && !isShield) continue;
+        if (shieldsFirst && pass == 1 && isShield)  continue;
+
+        uint8 bit = uint8(1u << i);
+        if (!(snap.ready & bit) || !(c.inRange & bit))
+            continue;
+        if (est.leavesAura && (c.hasOwnAura & bit))
+            continue;
+        if (est.cost > snap.power[i])
+            continue;
+
+        // Scripted heals with no readable amount still get a token score
+        // so they remain castable when nothing better is available.
+        float amount    = est.amount + est.pct * float(c.maxHealth) / 100.0f;
+        float effective = std::max(1.0f, std::min(amount, deficit));
+        float costScale = 1.0f + float(est.cost) / float(std::max<uint32>(snap.power[i], 1));
+        float timeScale = float(est.castTime) / 1000.0f;
+        float score     = effective / (costScale * timeScale);
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            best = static_cast<int8>(i);
+        }
+    }
+    return best;
+}
+
+static HealDecision DecideHeal(HealSnapshot const& snap)
+{
+    HealDecision d;
+    for (uint8 phase = 0; phase < MAX_HEAL_PHASES; ++phase)
+    {
+        int8 idx = snap.phaseTarget[phase];
+        if (idx < 0)
+            continue;
+
+        HealCandidate const& c = snap.candidates[idx];
+        bool shieldsFirst = phase == HEAL_PHASE_OWNER;
+        for (int pass = 0; pass < (shieldsFirst ? 2 : 1); ++pass)
+        {
+            int8 slot = PickHealSpell(snap, c, shieldsFirst, pass);
+            if (slot >= 0 && d.count < HealDecision::MAX_CHOICES)
+                d.choices[d.count++] = { c.guid, static_cast<uint8>(slot) };
+        }
+    }
+    return d;
+}
+
+// Units a guardian may act on: itself, its owner and the owner's pet, the
+// other guardians, a selected friendly NPC, its victim and enemies that are
+// casting or attacking an ally.
+enum GuardianSnapUnitFlags : uint16
+{
+    SNAP_UNIT_SELF       = 0x0001,
+    SNAP_UNIT_OWNER      = 0x0002,
+    SNAP_UNIT_PET        = 0x0004,
+    SNAP_UNIT_GUARDIAN   = 0x0008,   // active guardian of the same owner, self included
+    SNAP_UNIT_NEAR       = 0x0010,   // within 30yd, so ally buffs reach it
+    SNAP_UNIT_NPC        = 0x0020,   // injured friendly NPC the owner has selected
+    SNAP_UNIT_VICTIM     = 0x0040,
+    SNAP_UNIT_CASTING    = 0x0080,   // casting a non-melee spell
+    SNAP_UNIT_CASTING_CC = 0x0100,   // casting a stun, fear, confuse or interrupt
+    SNAP_UNIT_TAUNTABLE  = 0x0200    // creature with a threat list
+};
+
+struct GuardianSnapUnit
+{
+    ObjectGuid guid;
+    uint32 health      = 0;
+    uint32 maxHealth   = 0;
+    uint16 flags       = 0;
+    // Bit per spell slot, filled only for the slots that can act on the unit
+    uint8  inRange     = 0;   // friendly range for allies, hostile max range for enemies
+    uint8  inMinRange  = 0;   // hostile: inside the spell's min range
+    uint8  ownAura     = 0;   // our aura from that spell is on it
+    uint8  anyAura     = 0;   // anyone's aura from that spell is on it
+    uint8  dispellable = 0;   // carries an aura that spell dispels
+
+    float HealthPct() const { return maxHealth ? 100.0f * float(health) / float(maxHealth) : 0.0f; }
+};
+
+constexpr uint8 MAX_SNAP_UNITS   = 12;
+constexpr uint8 MAX_SNAP_CASTERS = 4;
+constexpr uint8 MAX_SNAP_PULLS   = 16;   // enemies on allies a tank pulls per tick
+
+struct GuardianSnapshot
+{
+    ObjectGuid        guardian;
+    uint8             archetype    = ARCHETYPE_DPS;
+    bool              rangedStance = false;   // ranged DPS, or a healer with a ranged stand-off
+    bool              outOfCombat  = false;
+    bool              casting      = false;
+    bool              tauntReady   = false;   // no taught taunt and the simulated one is off cooldown
+    GuardianSpellPlan plan;
+    uint8             ready          = 0;     // bit per slot: known and off cooldown
+    uint8             ccLongCooldown = 0;     // CC slots with over 10s of cooldown
+    GuardianSnapUnit  units[MAX_SNAP_UNITS];
+    uint8             unitCount = 0;
+    int8              self      = -1;
+    int8              victim    = -1;
+    int8              taunt     = -1;         // first enemy on an ally (tanks)
+    ObjectGuid        pulls[MAX_SNAP_PULLS];  // enemies on an ally (tanks)
+    uint8             pullCount = 0;
+    HealSnapshot      heal;                   // healers only
+};
+
+// Priority steps of the archetype chains. Each step casts at most once.
+enum GuardianStep : uint8
+{
+    STEP_EMERGENCY_HEAL = 0,
+    STEP_HEAL,
+    STEP_DISPEL,
+    STEP_ALLY_BUFF,
+    STEP_SELF_BUFF,
+    STEP_CC,
+    STEP_DEBUFF,
+    STEP_RANGED_OFFENSIVE,
+    STEP_FREE_OFFENSIVE,
+    STEP_MELEE,              // swing if ready; no spell
+    STEP_OFFENSIVE,
+    STEP_NPC_HEAL
+};
+
+struct GuardianAction
+{
+    ObjectGuid target;
+    uint32     spellId  = 0;
+    uint8      slot     = 0;
+    uint8      step     = 0;
+    bool       terminal = false;   // a cast here ends the chain
+};
+
+// Ordered fallbacks: the applier casts the first action of each step that is
+// still valid and stops after a terminal step casts.
+struct GuardianDecision
+{
+    static constexpr uint8 MAX_ACTIONS = 32;
+
+    ObjectGuid     pulls[MAX_SNAP_PULLS];
+    uint8          pullCount = 0;
+    ObjectGuid     taunt;
+    GuardianAction actions[MAX_ACTIONS];
+    uint8          actionCount = 0;
+
+    void Add(GuardianSnapshot const& s, uint8 step, bool terminal, uint8 slot, int8 unit)
+    {
+        if (actionCount < MAX_ACTIONS)
+            actions[actionCount++] = { s.units[unit].guid, s.plan.spellIds[slot], slot, step, terminal };
+    }
+
+    void AddMelee()
+    {
+        if (actionCount < MAX_ACTIONS)
+            actions[actionCount++] = { ObjectGuid::Empty, 0, 0, STEP_MELEE, false };
+    }
+};
+
+static bool SnapReady(GuardianSnapshot const& s, uint8 slot)
+{
+    return s.ready & (1u << slot);
+}
+
+// Lowest ally below `threshold`: self first, then the owner if asked, then
+// the other guardians.
+static int8 PickLowestAlly(GuardianSnapshot const& s, float threshold, bool includeOwner)
+{
+    int8  best   = -1;
+    float lowest = threshold;
+    auto Check = [&](int8 k)
+    {
+        float pct = s.units[k].HealthPct();
+        if (pct < lowest) { lowest = pct; best = k; }
+    };
+
+    if (s.self >= 0)
+        Check(s.self);
+    for (int8 k = 0; k < s.unitCount; ++k)
+    {
+        uint16 f = s.units[k].flags;
+        if (includeOwner && (f & SNAP_UNIT_OWNER))
+            Check(k);
+    }
+    for (int8 k = 0; k < s.unitCount; ++k)
+    {
+        uint16 f = s.units[k].flags;
+        if ((f & SNAP_UNIT_GUARDIAN) && !(f & SNAP_UNIT_SELF))
+            Check(k);
+    }
+    return best;
+}
+
+// Heals in plan order on one friendly unit (emergency and NPC heals)
+static void DecideFriendlyHeals(GuardianSnapshot const& s, GuardianDecision& d, uint8 step, bool terminal, int8 unit)
+{
+    if (unit < 0)
+        return;
+
+    GuardianSnapUnit const& u = s.units[unit];
+    for (uint8 n = 0; n < s.plan.healCount; ++n)
+    {
+        uint8 i = s.plan.heals[n];
+        uint8 bit = uint8(1u << i);
+        if (!SnapReady(s, i) || !(u.inRange & bit))
+            continue;
+        bool lingers = s.plan.flags[i] & (SPELL_PLAN_HOT | SPELL_PLAN_SHIELD);
+        if (lingers && (u.ownAura & bit))
+            continue;
+        d.Add(s, step, terminal, i, unit);
+    }
+}
+
+static void DecideHealPass(GuardianSnapshot const& s, GuardianDecision& d, bool terminal)
+{
+    HealDecision heal = DecideHeal(s.heal);
+    for (uint8 n = 0; n < heal.count && d.actionCount < GuardianDecision::MAX_ACTIONS; ++n)
+    {
+        HealChoice const& c = heal.choices[n];
+        d.actions[d.actionCount++] = { c.target, s.heal.spellIds[c.slot], c.slot, STEP_HEAL, terminal };
+    }
+}
+
+// Per dispel spell: owner, pet, the other guardians, then self
+static void DecideDispels(GuardianSnapshot const& s, GuardianDecision& d)
+{
+    for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+    {
+        if (!(s.plan.flags[i] & SPELL_PLAN_DISPEL) || !SnapReady(s, i))
+            continue;
+
+        uint8 bit = uint8(1u << i);
+        int8 target = -1;
+        for (uint16 mask : { uint16(SNAP_UNIT_OWNER), uint16(SNAP_UNIT_PET), uint16(SNAP_UNIT_GUARDIAN), uint16(SNAP_UNIT_SELF) })
+            for (int8 k = 0; k < s.unitCount && target < 0; ++k)
+            {
+                uint16 f = s.units[k].flags;
+                bool other = mask != SNAP_UNIT_GUARDIAN || !(f & SNAP_UNIT_SELF);
+                if ((f & mask) && other && (s.units[k].dispellable & bit))
+                    target = k;
+            }
+
+        if (target >= 0 && (s.units[target].inRange & bit))
+            d.Add(s, STEP_DISPEL, true, i, target);
+    }
+}
+
+// Per aura buff: the owner, then nearby guardians, that lack it
+static void DecideAllyBuffs(GuardianSnapshot const& s, GuardianDecision& d)
+{
+    for (uint8 n = 0; n < s.plan.buffCount; ++n)
+    {
+        uint8 i = s.plan.buffs[n];
+        if (!(s.plan.flags[i] & SPELL_PLAN_AURA) || !SnapReady(s, i))
+            continue;
+
+        uint8 bit = uint8(1u << i);
+        int8 target = -1;
+        for (uint16 mask : { uint16(SNAP_UNIT_OWNER), uint16(SNAP_UNIT_GUARDIAN | SNAP_UNIT_NEAR) })
+            for (int8 k = 0; k < s.unitCount && target < 0; ++k)
+            {
+                GuardianSnapUnit const& u = s.units[k];
+                if ((u.flags & mask) == mask && !(u.flags & SNAP_UNIT_SELF) && !(u.anyAura & bit))
+                    target = k;
+            }
+
+        if (target >= 0)
+            d.Add(s, STEP_ALLY_BUFF, true, i, target);
+    }
+}
+
+static void DecideSelfBuffs(GuardianSnapshot const& s, GuardianDecision& d, bool terminal)
+{
+    if (s.self < 0)
+        return;
+
+    for (uint8 n = 0; n < s.plan.buffCount; ++n)
+    {
+        uint8 i = s.plan.buffs[n];
+        if (SnapReady(s, i) && !(s.units[s.self].anyAura & (1u << i)))
+            d.Add(s, STEP_SELF_BUFF, terminal, i, s.self);
+    }
+}
+
+// Per CC spell: an enemy casting CC, else any caster, else the victim when
+// the spell's cooldown is short enough to spend on it.
+static void DecideCC(GuardianSnapshot const& s, GuardianDecision& d, int8 victim)
+{
+    for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+    {
+        if (!(s.plan.flags[i] & SPELL_PLAN_CC) || !SnapReady(s, i))
+            continue;
+
+        uint8 bit = uint8(1u << i);
+        int8 target = -1;
+        for (uint16 mask : { uint16(SNAP_UNIT_CASTING_CC), uint16(SNAP_UNIT_CASTING) })
+            for (int8 k = 0; k < s.unitCount && target < 0; ++k)
+                if ((s.units[k].flags & mask) && (s.units[k].inRange & bit))
+                    target = k;
+
+        if (target < 0 && !(s.ccLongCooldown & bit))
+            target = victim;
+
+        if (target >= 0 && (s.units[target].inRange & bit))
+            d.Add(s, STEP_CC, true, i, target);
+    }
+}
+
+static void DecideDebuffs(GuardianSnapshot const& s, GuardianDecision& d, int8 victim, bool terminal)
+{
+    if (victim < 0)
+        return;
+
+    GuardianSnapUnit const& u = s.units[victim];
+    for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+    {
+        uint8 bit = uint8(1u << i);
+        if ((s.plan.flags[i] & SPELL_PLAN_DEBUFF) && SnapReady(s, i) && !(u.ownAura & bit) && (u.inRange & bit))
+            d.Add(s, STEP_DEBUFF, terminal, i, victim);
+    }
+}
+
+// Offensive spells in plan order. `required` narrows the pass to ranged or
+// free spells; those passes also respect the spell's min range.
+static void DecideOffensive(GuardianSnapshot const& s, GuardianDecision& d, int8 victim, uint8 step, bool terminal,
+    uint16 required)
+{
+    if (victim < 0)
+        return;
+
+    GuardianSnapUnit const& u = s.units[victim];
+    for (uint8 n = 0; n < s.plan.offensiveCount; ++n)
+    {
+        uint8 i = s.plan.offensive[n];
+        uint8 bit = uint8(1u << i);
+        if ((s.plan.flags[i] & required) != required || !SnapReady(s, i) || !(u.inRange & bit))
+            continue;
+        if (required && (u.inMinRange & bit))
+            continue;
+        if ((s.plan.flags[i] & SPELL_PLAN_PERIODIC) && (u.ownAura & bit))
+            continue;
+        d.Add(s, step, terminal, i, victim);
+    }
+}
+
+static GuardianDecision DecideGuardian(GuardianSnapshot const& s)
+{
+    GuardianDecision d;
+
+    // Tanks pull every enemy on an ally and taunt the first one. A taunt
+    // switches the victim, so the casts below aim at the taunted enemy.
+    int8 victim = s.victim;
+    if (s.archetype == ARCHETYPE_TANK && !s.outOfCombat)
+    {
+        std::copy(s.pulls, s.pulls + s.pullCount, d.pulls);
+        d.pullCount = s.pullCount;
+        if (s.taunt >= 0 && s.tauntReady && (s.units[s.taunt].flags & SNAP_UNIT_TAUNTABLE))
+        {
+            d.taunt = s.units[s.taunt].guid;
+            victim  = s.taunt;
+        }
+    }
+
+    if (s.casting)
+        return d;
+
+    if (s.outOfCombat)
+    {
+        if (s.archetype == ARCHETYPE_HEALER)
+        {
+            DecideHealPass(s, d, false);
+            for (int8 k = 0; k < s.unitCount; ++k)
+                if (s.units[k].flags & SNAP_UNIT_NPC)
+                    DecideFriendlyHeals(s, d, STEP_NPC_HEAL, false, k);
+        }
+        else if (s.archetype == ARCHETYPE_DPS)
+            DecideFriendlyHeals(s, d, STEP_EMERGENCY_HEAL, true, PickLowestAlly(s, 90.0f, true));
+        return d;
+    }
+
+    switch (s.archetype)
+    {
+        case ARCHETYPE_TANK:
+            DecideSelfBuffs(s, d, false);
+            DecideCC(s, d, victim);
+            DecideOffensive(s, d, victim, STEP_OFFENSIVE, false, 0);
+            break;
+        case ARCHETYPE_HEALER:
+            DecideHealPass(s, d, true);
+            DecideDispels(s, d);
+            DecideAllyBuffs(s, d);
+            DecideSelfBuffs(s, d, true);
+            DecideDebuffs(s, d, victim, true);
+            if (s.rangedStance)
+                DecideOffensive(s, d, victim, STEP_RANGED_OFFENSIVE, true, SPELL_PLAN_FREE | SPELL_PLAN_RANGED);
+            d.AddMelee();
+            DecideOffensive(s, d, victim, STEP_FREE_OFFENSIVE, false, SPELL_PLAN_FREE);
+            for (int8 k = 0; k < s.unitCount; ++k)
+                if (s.units[k].flags & SNAP_UNIT_NPC)
+                    DecideFriendlyHeals(s, d, STEP_NPC_HEAL, false, k);
+            break;
+        default:
+            if (s.rangedStance)
+            {
+                DecideFriendlyHeals(s, d, STEP_EMERGENCY_HEAL, true, PickLowestAlly(s, 35.0f, false));
+                DecideCC(s, d, victim);
+                DecideOffensive(s, d, victim, STEP_RANGED_OFFENSIVE, true, SPELL_PLAN_RANGED);
+                DecideAllyBuffs(s, d);
+                DecideSelfBuffs(s, d, true);
+                DecideDebuffs(s, d, victim, false);
+                d.AddMelee();
+                DecideOffensive(s, d, victim, STEP_OFFENSIVE, false, 0);
             }
+            else
+            {
+                DecideFriendlyHeals(s, d, STEP_EMERGENCY_HEAL, true, PickLowestAlly(s, 35.0f, false));
+                DecideAllyBuffs(s, d);
+                DecideSelfBuffs(s, d, true);
+                DecideCC(s, d, victim);
+                DecideDebuffs(s, d, victim, false);
+                DecideOffensive(s, d, victim, STEP_OFFENSIVE, false, 0);
+            }
+            break;
+    }
+    return d;
+}
+
+// Small persistent pool for the decide phase. Run() splits [0, count) across
+// the workers and the calling thread and returns when every index is done.
+class DecisionWorkerPool
+{
+public:
+    ~DecisionWorkerPool() { Stop(); }
+
+    void Start(uint32 threads)
+    {
+        if (!_workers.empty())
+            return;
+        _stopping = false;
+        for (uint32 i = 0; i < threads; ++i)
+            _workers.emplace_back(&DecisionWorkerPool::WorkerLoop, this);
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _stopping = true;
+        }
+        _wake.notify_all();
+        for (std::thread& t : _workers)
+            if (t.joinable())
+                t.join();
+        _workers.clear();
+    }
+
+    void Run(size_t count, std::function<void(size_t)> const& fn)
+    {
+        if (_workers.empty() || count < 2)
+        {
+            for (size_t i = 0; i < count; ++i)
+                fn(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _job = &fn;
+            _count = count;
+            _next.store(0, std::memory_order_relaxed);
+            ++_generation;
+        }
+        _wake.notify_all();
+
+        Work();
+
+        std::unique_lock<std::mutex> lock(_lock);
+        _done.wait(lock, [this] { return _active == 0; });
+        _job = nullptr;
+    }
+
+private:
+    void Work()
+    {
+        for (;;)
+        {
+            size_t i = _next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= _count)
+                break;
+            (*_job)(i);
+        }
+    }
+
+    void WorkerLoop()
+    {
+        uint64 seen = 0;
+        std::unique_lock<std::mutex> lock(_lock);
+        for (;;)
+        {
+            _wake.wait(lock, [&] { return _stopping || (_job && _generation != seen); });
+            if (_stopping)
+                break;
+
+            seen = _generation;
+            ++_active;
+            lock.unlock();
+            Work();
+            lock.lock();
+            if (--_active == 0)
+                _done.notify_all();
+        }
+    }
+
+    std::vector<std::thread> _workers;
+    std::mutex _lock;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    std::function<void(size_t)> const* _job = nullptr;
+    size_t _count = 0;
+    std::atomic<size_t> _next { 0 };
+    uint64 _generation = 0;
+    uint32 _active = 0;
+    bool _stopping = false;
+};
+
+// Collects in-combat guardian snapshots from every map thread during the map
+// update and decides them all on the world thread's next update, while no
+// map is running. Each guardian applies its decision on its following AI
+// tick. Only used once ParallelAI.MinGuardians guardians were seen in the
+// last tick; below that every guardian decides inline.
+class GuardianDecisionBatch
+{
+public:
+    void Start()
+    {
+        if (config.parallelAIEnabled)
+            _pool.Start(config.parallelAIThreads);
+    }
+
+    void Stop() { _pool.Stop(); }
+
+    // Map threads: a guardian about to make its combat decision
+    void NoteGuardian() { _guardiansThisTick.fetch_add(1, std::memory_order_relaxed); }
+
+    bool Active() const { return _active; }
+
+    void Submit(GuardianSnapshot const& snap)
+    {
+        std::lock_guard<std::mutex> lock(_submitLock);
+        _submitted.push_back(snap);
+    }
+
+    // Map threads, read-only while maps update
+    GuardianDecision const* Find(ObjectGuid guardian) const
+    {
+        auto itr = _index.find(guardian);
+        return itr != _index.end() ? &_results[itr->second] : nullptr;
+    }
+
+    // World thread, between map updates
+    void Update()
+    {
+        uint32 guardians = _guardiansThisTick.exchange(0, std::memory_order_relaxed);
+        _active = config.parallelAIEnabled && guardians >= config.parallelAIMinGuardians;
+
+        _index.clear();
+        _deciding.swap(_submitted);
+        _submitted.clear();
+        if (_deciding.empty())
+            return;
+
+        auto start = std::chrono::steady_clock::now();
+        _results.resize(_deciding.size());
+        _pool.Run(_deciding.size(), [this](size_t i) { _results[i] = DecideGuardian(_deciding[i]); });
+        metrics.aiDecideUs.fetch_add(uint64(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count()), std::memory_order_relaxed);
+
+        for (size_t i = 0; i < _deciding.size(); ++i)
+            _index[_deciding[i].guardian] = uint32(i);
+
+        metrics.aiBatches.fetch_add(1, std::memory_order_relaxed);
+        metrics.aiBatchDecisions.fetch_add(_deciding.size(), std::memory_order_relaxed);
+    }
+
+private:
+    DecisionWorkerPool _pool;
+    std::atomic<uint32> _guardiansThisTick { 0 };
+    bool _active = false;
+
+    std::mutex _submitLock;
+    std::vector<GuardianSnapshot> _submitted;   // filled by map threads
+    std::vector<GuardianSnapshot> _deciding;    // last tick's, decided here
+    std::vector<GuardianDecision> _results;
+    std::unordered_map<ObjectGuid, uint32> _index;
+};
+
+static GuardianDecisionBatch s_aiBatch;
+
+// ============================================================================
+// CapturedGuardianAI — Archetype-driven combat AI
+// ============================================================================
+
+class CapturedGuardianAI : public CreatureAI
+{
+public:
+    explicit CapturedGuardianAI(Creature* creature, uint8 archetype, uint32 const* spells, uint8 slotIndex, bool rangedDps = false,
+        GuardianSpellPlan const* plan = nullptr)
+        : CreatureAI(creature),
+        _owner(nullptr),
+        _archetype(archetype),
+        _slotIndex(slotIndex),
+        _rangedDps(rangedDps),
+        _preferredRange(0.0f),
+        _recoveryRange(0.0f),
+        _updateTimer(1000),
+        _combatCheckTimer(500),
+        _regenTimer(2000)
+    {
+        if (spells)
+            memcpy(_spellSlots, spells, sizeof(_spellSlots));
+        else
+            memset(_spellSlots, 0, sizeof(_spellSlots));
+
+        // Reuse the slot's cached plan when it matches this loadout
+        if (plan && plan->IsBuiltFor(_spellSlots))
+        {
+            _plan = *plan;
+            RecalcPreferredRange();
+            RebuildHealEstimates();
         }
+        else
+            RebuildSpellPlan();
+
+        // Equip fallback weapons for any spells that need them (e.g. Shoot needs a bow)
+        EquipFallbackWeapons();
+
+        if (ObjectGuid ownerGuid = me->GetOwnerGUID())
+            _owner = ObjectAccessor::GetPlayer(*me, ownerGuid);
+    }
+
+    ~CapturedGuardianAI() override
+    {
+        if (_dormant)
+            metrics.dormantGuardians.fetch_sub(1, std::memory_order_relaxed);
+    }
 
+    float GetFollowDist() const
+    {
+        return GUARDIAN_FOLLOW_DIST;
+    }
+
+    float GetFollowAngle() const
+    {
+        return GUARDIAN_FOLLOW_ANGLES[_slotIndex % MAX_GUARDIAN_SLOTS];
+    }
+
+    void SetArchetype(uint8 arch)
+    {
+        _archetype = arch;
         RecalcPreferredRange();
+        if (_owner && !me->GetVictim())
+        {
+            me->GetMotionMaster()->Clear();
+            me->GetMotionMaster()->MoveFollow(_owner, GetFollowDist(), GetFollowAngle());
+        }
     }
 
+    uint8 GetArchetype() const { return _archetype; }
+    uint8 GetSlotIndex() const { return _slotIndex; }
+    bool  IsRangedDps()  const { return _rangedDps; }
+
+    void SetRangedDps(bool ranged)
+    {
+        _rangedDps = ranged;
+        RecalcPreferredRange();
+        if (_owner && !me->GetVictim())
+        {
+            me->GetMotionMaster()->Clear();
+            me->GetMotionMaster()->MoveFollow(_owner, GetFollowDist(), GetFollowAngle());
+        }
+    }
+
+    void SetSpell(uint32 slot, uint32 spellId)
+    {
+        if (slot < MAX_GUARDIAN_SPELLS)
+            _spellSlots[slot] = spellId;
+
+        RebuildSpellPlan();
+        EquipFallbackWeapons();
+    }
+
+    // Replace the whole loadout and rebuild derived spell state once.
+    void SetSpells(uint32 const* spells)
+    {
+        memcpy(_spellSlots, spells, sizeof(_spellSlots));
+
+        RebuildSpellPlan();
+        EquipFallbackWeapons();
+    }
+
+    // Classify every spell in a loadout once: roles, ranges, weapon needs and
+    // the stand-off distances used by ranged DPS and healers. Depends only on
+    // the spell IDs, so the result is cached per slot (see GetSlotSpellPlan).
+    static void BuildSpellPlan(GuardianSpellPlan& plan, uint32 const* spells);
+
     uint32 GetSpell(uint32 slot) const
     {
         return (slot < MAX_GUARDIAN_SPELLS) ? _spellSlots[slot] : 0;
@@ -653,11 +3059,70 @@ public:
 
     uint32 const* GetSpells() const { return _spellSlots; }
 
+    // Capture cooldowns, self-buffs and timers before the creature despawns.
+    void SaveRuntimeState(GuardianRuntimeState& state) const
+    {
+        state.Clear();
+        state.savedAtMs = GameTime::GetGameTimeMS().count();
+        state.tauntTimer   = _tauntTimer;
+        state.helpCryTimer = _helpCryTimer;
+
+        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        {
+            uint32 spellId = _spellSlots[i];
+            state.spellIds[i] = spellId;
+            if (!spellId)
+                continue;
+
+            state.cooldownMs[i] = me->GetSpellCooldown(spellId);
+            if (Aura const* aura = me->GetAura(spellId, me->GetGUID()))
+                state.auraMs[i] = aura->GetDuration();
+        }
+    }
+
+    // Re-apply saved state to a freshly summoned creature. Buffs are added as
+    // auras rather than recast, so there is no cast bar, cost or cooldown reset.
+    void RestoreRuntimeState(GuardianRuntimeState const& state)
+    {
+        if (!state.IsSet())
+            return;
+
+        uint64 now     = GameTime::GetGameTimeMS().count();
+        int32  elapsed = now > state.savedAtMs ? int32(std::min<uint64>(now - state.savedAtMs, INT32_MAX)) : 0;
+
+        _tauntTimer   = std::max(state.tauntTimer - elapsed, 0);
+        _helpCryTimer = std::max(state.helpCryTimer - elapsed, 0);
+
+        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        {
+            uint32 spellId = _spellSlots[i];
+            if (!spellId || state.spellIds[i] != spellId)
+                continue;
+
+            if (state.cooldownMs[i] > uint32(elapsed))
+                me->AddSpellCooldown(spellId, 0, state.cooldownMs[i] - elapsed);
+
+            int32 auraMs = state.auraMs[i];
+            if (auraMs == 0 || (auraMs > 0 && auraMs <= elapsed))
+                continue;
+
+            if (Aura* aura = me->AddAura(spellId, me))
+                if (auraMs > 0)
+                    aura->SetDuration(auraMs - elapsed);
+        }
+    }
+
     void UpdateAI(uint32 diff) override
     {
+        CC_PROFILE_ZONE("CapturedGuardianAI::UpdateAI");
+        CC_PROFILE_ANNOTATE(me->GetEntry(), _archetype);
         if (!me->IsAlive())
             return;
 
+        // Dormant: only the watchdog runs until the owner moves or combat starts
+        if (_dormant && !DormancyWatchdog())
+            return;
+
         if (_helpCryTimer > 0)
             _helpCryTimer -= diff;
         if (_tauntTimer > 0)
@@ -689,6 +3154,9 @@ public:
                 _owner->GetClosePoint(x, y, z, me->GetCombatReach(), GetFollowDist(), GetFollowAngle());
                 me->NearTeleportTo(x, y, z, me->GetOrientation());
             }
+
+            if (_owner && UpdateOwnerIdle(1000))
+                return;
         }
 
         // Send health/power sync to owner addon
@@ -763,7 +3231,7 @@ public:
                     if (ownerAttacker && ownerAttacker != me->GetVictim() &&
                         ownerAttacker->IsAlive() && me->CanCreatureAttack(ownerAttacker))
                     {
-                        me->AddThreat(ownerAttacker, 200.0f);
+                        PullThreat(ownerAttacker, 200.0f);
                         AttackStart(ownerAttacker);
                     }
                 }
@@ -859,27 +3327,9 @@ public:
                             }
                         }
 
-                        // Healer: heal out of combat if owner, pet, or any ally is hurt
-                        auto needsHealing = [](Unit* u) { return u && u->IsAlive() && u->GetHealthPct() < 90.0f; };
-                        bool shouldHeal = needsHealing(_owner) || needsHealing(me);
-                        if (!shouldHeal && ownerPet)
-                            shouldHeal = needsHealing(ownerPet);
-                        if (!shouldHeal)
-                        {
-                            CapturedGuardianData* gdata = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-                            for (uint8 gi = 0; gi < MAX_GUARDIAN_SLOTS && !shouldHeal; ++gi)
-                            {
-                                GuardianSlotData& gs = gdata->slots[gi];
-                                if (!gs.IsActive() || gs.guardianGuid == me->GetGUID()) continue;
-                                Creature* ally = ObjectAccessor::GetCreature(*me, gs.guardianGuid);
-                                shouldHeal = needsHealing(ally);
-                            }
-                        }
-                        if (shouldHeal)
-                            DoCastHealingSpells(true);
-
-                        // Also heal a friendly injured NPC the player has targeted (lowest priority)
-                        DoCastTargetedNPCHeal();
+                        // Healer: heal the owner, pet or any ally below 90%, then a
+                        // friendly injured NPC the player has targeted (lowest priority)
+                        RunIdleDecision();
                     }
                     else if (_archetype == ARCHETYPE_TANK)
                     {
@@ -892,7 +3342,7 @@ public:
                         {
                             if (me->CanCreatureAttack(ownerOrPetAttacker))
                             {
-                                me->AddThreat(ownerOrPetAttacker, 200.0f);
+                                PullThreat(ownerOrPetAttacker, 200.0f);
                                 AttackStart(ownerOrPetAttacker);
                                 return;
                             }
@@ -901,7 +3351,7 @@ public:
                         // Tank: pull mobs off non-tank guardians
                         if (Unit* allyAttacker = FindAllyAttacker(/*excludeTanks=*/true))
                         {
-                            me->AddThreat(allyAttacker, 200.0f);
+                            PullThreat(allyAttacker, 200.0f);
                             AttackStart(allyAttacker);
                             return;
                         }
@@ -911,7 +3361,7 @@ public:
                         {
                             if (attacker && attacker->IsAlive() && me->CanCreatureAttack(attacker))
                             {
-                                me->AddThreat(attacker, 100.0f);
+                                PullThreat(attacker, 100.0f);
                                 AttackStart(attacker);
                                 return;
                             }
@@ -951,7 +3401,7 @@ public:
                         }
 
                         // DPS: heal self, owner, or guardians out of combat if anyone is hurt
-                        DoCastEmergencyHeals(90.0f, true);
+                        RunIdleDecision();
                     }
                 }
             }
@@ -1030,6 +3480,9 @@ public:
         if (!target || !me->CanCreatureAttack(target))
             return;
 
+        if (_dormant)
+            WakeFromDormancy();
+
         // Healer refuses to engage unless someone else is already tanking
         if (_archetype == ARCHETYPE_HEALER && !HasEstablishedTank(target))
             return;
@@ -1059,7 +3512,10 @@ public:
         me->CombatStop(true);
         me->GetMotionMaster()->Clear();
         if (_owner)
+        {
+            GetGuardianData(_owner)->credit.ClearSlot(_slotIndex);
             me->GetMotionMaster()->MoveFollow(_owner, GetFollowDist(), GetFollowAngle());
+        }
     }
 
     void JustEngagedWith(Unit* /*who*/) override { }
@@ -1069,8 +3525,10 @@ public:
         if (_owner && victim && victim->IsCreature())
         {
             Creature* killed = victim->ToCreature();
-            killed->SetLootRecipient(_owner);
-            killed->LowerPlayerDamageReq(killed->GetMaxHealth());
+            CreditOwnerFor(killed);
+            LogCaptureEvent(CAPTURE_EVENT_KILL, _owner, _slotIndex,
+                GetGuardianData(_owner)->slots[_slotIndex], killed->GetEntry());
+            GetGuardianData(_owner)->credit.Remove(killed->GetGUID());
             TryLeechFromKill(_owner, killed);
         }
     }
@@ -1079,6 +3537,9 @@ public:
 
     void DamageTaken(Unit* /*attacker*/, uint32& /*damage*/, DamageEffectType /*damageType*/, SpellSchoolMask /*schoolMask*/) override
     {
+        if (_dormant)
+            WakeFromDormancy();
+
         if (_archetype == ARCHETYPE_HEALER && _helpCryTimer <= 0)
         {
             me->Say("I'm under attack!", LANG_UNIVERSAL);
@@ -1089,34 +3550,50 @@ public:
     void DamageDealt(Unit* victim, uint32& /*damage*/, DamageEffectType /*damageType*/, SpellSchoolMask /*damageSchoolMask*/) override
     {
         if (victim && victim->IsCreature() && _owner)
-        {
-            Creature* target = victim->ToCreature();
-            target->SetLootRecipient(_owner);
-            target->LowerPlayerDamageReq(target->GetHealth());
-        }
+            CreditOwnerFor(victim->ToCreature());
     }
 
-    void JustDied(Unit* /*killer*/) override
+    void JustDied(Unit* killer) override
     {
         if (_owner)
         {
             ChatHandler(_owner->GetSession()).PSendSysMessage("Your captured guardian has died.");
 
-            CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+            CapturedGuardianData* data = GetGuardianData(_owner);
             GuardianSlotData& s = data->slots[_slotIndex];
+            data->credit.ClearSlot(_slotIndex);
 
             if (s.IsOccupied())
             {
+                LogCaptureEvent(CAPTURE_EVENT_DEATH, _owner, _slotIndex, s,
+                    (killer && killer->IsCreature()) ? killer->GetEntry() : 0);
+                s.runtime.Clear();
                 s.guardianGuid.Clear();
                 s.guardianHealth = 1;
                 s.dismissed = true;
                 SaveGuardianSlotToDb(_owner, &s, _slotIndex);
                 SendGuardianDismiss(_owner, _slotIndex);
+                BumpSlotVersion(_owner, _slotIndex);
             }
         }
     }
 
 private:
+    // Give the owner loot and XP credit for target, once per engagement.
+    // A target already tapped by the owner or their group keeps its tap
+    // (SetLootRecipient would otherwise re-resolve the group on every hit).
+    void CreditOwnerFor(Creature* target)
+    {
+        CapturedGuardianData* data = GetGuardianData(_owner);
+        if (target->hasLootRecipient() && data->credit.Contains(target->GetGUID()))
+            return;
+
+        if (!target->hasLootRecipient() || !target->isTappedBy(_owner))
+            target->SetLootRecipient(_owner);
+        target->LowerPlayerDamageReq(target->GetMaxHealth());
+        data->credit.Add(target->GetGUID(), _slotIndex);
+    }
+
     // Check if the target has established threat from the owner or any friendly combatant.
     // Only called on targets already known to be owner-related, so just verify
     // someone is actively tanking (has meaningful threat on the target's threat list).
@@ -1136,7 +3613,7 @@ private:
     }
 
     // Check if a spell has zero power cost
-    bool IsFreeCostSpell(SpellInfo const* spellInfo)
+    static bool IsFreeCostSpell(SpellInfo const* spellInfo)
     {
         if (!spellInfo)
             return false;
@@ -1150,7 +3627,7 @@ private:
     // Covers HEAL (direct), HEAL_PCT (% max HP), HEAL_MAX_HEALTH (full restore),
     // and PERIODIC_HEAL auras (HoTs). Used to detect heals and exclude them
     // from buff/debuff paths.
-    bool IsHealingSpell(SpellInfo const* spellInfo)
+    static bool IsHealingSpell(SpellInfo const* spellInfo)
     {
         if (!spellInfo)
             return false;
@@ -1162,7 +3639,7 @@ private:
     }
 
     // Check if a spell is ranged (max range > 5 yards, non-melee)
-    bool IsRangedSpell(SpellInfo const* spellInfo)
+    static bool IsRangedSpell(SpellInfo const* spellInfo)
     {
         if (!spellInfo)
             return false;
@@ -1186,7 +3663,16 @@ private:
         return false;
     }
 
-    // Recalculate preferred ranged distance from taught spells.
+    // Refresh everything derived from the loadout: spell plan, preferred
+    // range and heal estimates.
+    void RebuildSpellPlan()
+    {
+        BuildSpellPlan(_plan, _spellSlots);
+        RecalcPreferredRange();
+        RebuildHealEstimates();
+    }
+
+    // Pick the stand-off distances from the spell plan.
     // Used by ranged DPS stance and healers (healers always prefer range).
     void RecalcPreferredRange()
     {
@@ -1195,36 +3681,74 @@ private:
         if (!_rangedDps && _archetype != ARCHETYPE_HEALER)
             return;
 
-        float smallestMax = 999.0f;
-        float biggestMin  = 0.0f;
+        _preferredRange = _plan.rangedPreferred;
+        _recoveryRange  = _plan.rangedRecovery;
+    }
+
+    // Precompute heal amount, cast time and cost for every taught heal so
+    // the heal pass can rank them without walking spell effects each tick.
+    // Amounts use level-scaled base points; rebuilt when spells or level change.
+    void RebuildHealEstimates()
+    {
+        _healEstimateLevel = me->GetLevel();
+
         for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
         {
-            if (!_spellSlots[i])
-                continue;
+            HealEstimate& est = _healEstimates[i];
+            est = HealEstimate();
 
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(_spellSlots[i]);
-            if (!spellInfo || spellInfo->IsPositive())
+            SpellInfo const* spellInfo = _spellSlots[i] ? sSpellMgr->GetSpellInfo(_spellSlots[i]) : nullptr;
+            if (!spellInfo || !spellInfo->IsPositive())
                 continue;
 
-            if (IsRangedSpell(spellInfo))
+            for (uint8 eff = 0; eff < MAX_SPELL_EFFECTS; ++eff)
             {
-                float maxRange = spellInfo->GetMaxRange(false);
-                if (maxRange < smallestMax)
-                    smallestMax = maxRange;
-
-                float minRange = spellInfo->GetMinRange(false);
-                if (minRange > biggestMin)
-                    biggestMin = minRange;
+                SpellEffectInfo const& effect = spellInfo->Effects[eff];
+                switch (effect.Effect)
+                {
+                    case SPELL_EFFECT_HEAL:
+                        est.amount += float(effect.CalcValue(me));
+                        est.kind = HEAL_KIND_DIRECT;
+                        break;
+                    case SPELL_EFFECT_HEAL_PCT:
+                        est.pct += float(effect.CalcValue(me));
+                        est.kind = HEAL_KIND_DIRECT;
+                        break;
+                    case SPELL_EFFECT_HEAL_MAX_HEALTH:
+                        est.pct = 100.0f;
+                        est.kind = HEAL_KIND_DIRECT;
+                        break;
+                    case SPELL_EFFECT_APPLY_AURA:
+                        if (effect.ApplyAuraName == SPELL_AURA_PERIODIC_HEAL)
+                        {
+                            int32 duration = spellInfo->GetMaxDuration();
+                            uint32 ticks   = (effect.Amplitude > 0 && duration > 0) ? uint32(duration / effect.Amplitude) : 1;
+                            est.amount += float(effect.CalcValue(me)) * float(ticks);
+                            est.leavesAura = true;
+                            if (est.kind == HEAL_KIND_NONE)
+                                est.kind = HEAL_KIND_HOT;
+                        }
+                        else if (effect.ApplyAuraName == SPELL_AURA_SCHOOL_ABSORB)
+                        {
+                            est.amount += float(effect.CalcValue(me));
+                            est.leavesAura = true;
+                            if (est.kind == HEAL_KIND_NONE)
+                                est.kind = HEAL_KIND_SHIELD;
+                        }
+                        break;
+                    default:
+                        break;
+                }
             }
-        }
 
-        if (smallestMax < 999.0f)
-            _preferredRange = smallestMax * 0.8f; // stay slightly inside max range
+            if (est.kind == HEAL_KIND_NONE)
+                continue;
 
-        // Recovery range: just past the biggest minimum range so all
-        // ranged spells can fire.  Used for deadzone retreat distance
-        // and for re-engaging at range after melee.
-        _recoveryRange = biggestMin + 3.0f;
+            // Instant casts still cost a global cooldown
+            est.castTime  = std::max<int32>(spellInfo->CalcCastTime(me), 1500);
+            est.powerType = uint8(spellInfo->PowerType);
+            est.cost      = IsFreeCostSpell(spellInfo) ? 0 : uint32(std::max<int32>(spellInfo->CalcPowerCost(me, spellInfo->GetSchoolMask()), 0));
+        }
     }
 
     // Find an enemy attacking a fellow guardian or the owner's pet.
@@ -1247,7 +3771,7 @@ private:
             }
         }
 
-        CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = GetGuardianData(_owner);
         for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
         {
             GuardianSlotData& s = data->slots[i];
@@ -1286,7 +3810,7 @@ private:
             }
         }
 
-        CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = GetGuardianData(_owner);
         for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
         {
             GuardianSlotData& s = data->slots[i];
@@ -1304,41 +3828,91 @@ private:
         return nullptr;
     }
 
-    // Equip a fallback weapon if the spell requires one and the creature lacks it
-    void EquipFallbackWeaponForSpell(uint32 spellId)
+    // Equip fallback weapons the loadout requires and the creature lacks
+    void EquipFallbackWeapons()
     {
-        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-        if (!spellInfo)
-            return;
-
-        // Check for ranged weapon need: DmgClass ranged, or uses ranged slot, or auto-repeat
-        bool needsRanged = (spellInfo->DmgClass == SPELL_DAMAGE_CLASS_RANGED &&
-                            spellInfo->IsRangedWeaponSpell()) ||
-                           spellInfo->HasAttribute(SPELL_ATTR0_USES_RANGED_SLOT);
-
-        if (needsRanged && !me->HasWeapon(RANGED_ATTACK))
+        if (_plan.needsRangedWeapon && !me->HasWeapon(RANGED_ATTACK))
         {
             // 2504 = Worn Shortbow (common item in all AzerothCore DBs)
             me->SetUInt32Value(UNIT_VIRTUAL_ITEM_SLOT_ID + 2, 2504);
-            return;
         }
 
-        // Check for melee weapon need: DmgClass melee with weapon damage effects
-        bool needsMelee = spellInfo->DmgClass == SPELL_DAMAGE_CLASS_MELEE &&
-                          (spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE) ||
-                           spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE_NOSCHOOL) ||
-                           spellInfo->HasEffect(SPELL_EFFECT_NORMALIZED_WEAPON_DMG) ||
-                           spellInfo->HasAttribute(SPELL_ATTR3_REQUIRES_MAIN_HAND_WEAPON));
-
-        if (needsMelee && !me->HasWeapon(BASE_ATTACK))
+        if (_plan.needsMeleeWeapon && !me->HasWeapon(BASE_ATTACK))
         {
             // 25 = Worn Shortsword (common item in all AzerothCore DBs)
             me->SetUInt32Value(UNIT_VIRTUAL_ITEM_SLOT_ID, 25);
         }
     }
 
+    // --- Idle-owner dormancy ---
+    // Once the owner has stood still (or gone AFK) for Dormancy.IdleSeconds
+    // with nothing to fight or heal, the guardian skips its whole update loop
+    // and only checks, each tick, whether the owner moved or anyone entered
+    // combat. Damage taken or an AttackStart wakes it immediately as well.
+
+    static constexpr float DORMANCY_MOVE_DIST_SQ = 1.0f;   // owner moved more than 1 yd
+
+    // Called once per owner refresh while awake. Returns true if the guardian
+    // just went dormant.
+    bool UpdateOwnerIdle(uint32 elapsed)
+    {
+        if (_owner->GetExactDist2dSq(_ownerIdlePos) > DORMANCY_MOVE_DIST_SQ)
+        {
+            _ownerIdlePos.Relocate(_owner);
+            _ownerIdleMs = 0;
+            return false;
+        }
+
+        _ownerIdleMs += elapsed;
+        if (!config.dormancyEnabled)
+            return false;
+
+        bool idle = _owner->isAFK() || _ownerIdleMs >= config.dormancyIdleSeconds * IN_MILLISECONDS;
+        if (!idle || me->GetVictim() || me->IsInCombat() || _owner->IsInCombat())
+            return false;
+
+        // Let out-of-combat regen and healer top-ups finish first
+        if (!me->IsFullHealth() || _owner->GetHealthPct() < 90.0f)
+            return false;
+
+        _dormant = true;
+        metrics.dormantGuardians.fetch_add(1, std::memory_order_relaxed);
+        metrics.dormancyEntries.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Returns true if the guardian woke up and should run a normal update.
+    bool DormancyWatchdog()
+    {
+        if (config.dormancyEnabled && _owner && _owner->IsInWorld() &&
+            !me->IsInCombat() && !_owner->IsInCombat() && !me->GetVictim() &&
+            _owner->GetExactDist2dSq(_ownerIdlePos) <= DORMANCY_MOVE_DIST_SQ)
+            return false;
+
+        WakeFromDormancy();
+        return true;
+    }
+
+    void WakeFromDormancy()
+    {
+        _dormant = false;
+        _ownerIdleMs = 0;
+        if (_owner)
+            _ownerIdlePos.Relocate(_owner);
+
+        // React on this tick instead of waiting out the timers
+        _updateTimer = 0;
+        _combatCheckTimer = 0;
+        _healthPowerSyncTimer = 0;
+
+        metrics.dormantGuardians.fetch_sub(1, std::memory_order_relaxed);
+        metrics.dormancyWakes.fetch_add(1, std::memory_order_relaxed);
+    }
+
     void UpdateDpsAI(uint32 /*diff*/)
     {
+        CC_PROFILE_ZONE("CapturedGuardianAI::UpdateDpsAI");
+        CC_PROFILE_ANNOTATE(me->GetEntry(), _archetype);
         if (_rangedDps && _preferredRange > 5.0f)
             UpdateRangedDpsAI();
         else
@@ -1358,26 +3932,8 @@ private:
 
         DoMeleeAttackIfReady();
 
-        // Priority 1: Emergency heal self or a fellow guardian below 35%
-        if (DoCastEmergencyHeals())
-            return;
-
-        // Priority 2: Buff allies (owner + other guardians + self) — e.g. Fire Shield
-        if (DoCastAllyBuffs())
-            return;
-
-        // Priority 3: Self buffs
-        if (DoCastSelfBuffs())
-            return;
-
-        // Priority 4: CC spells (interrupt/stun priority casters, then any caster, else skip if long CD)
-        if (DoCastCCSpells()) return;
-
-        // Priority 5: Debuffs on current target
-        DoCastDebuffSpells();
-
-        // Priority 6: Offensive damage spells
-        DoCastOffensiveSpells();
+        // Emergency heals, ally and self buffs, CC, debuffs, damage
+        RunCombatDecision();
     }
 
     void UpdateRangedDpsAI()
@@ -1443,497 +3999,342 @@ private:
             }
         }
 
-        // Priority 1: Emergency heal self or a fellow guardian below 35%
-        if (DoCastEmergencyHeals())
-            return;
-
-        // Priority 2: CC spells (interrupt/stun priority casters, then any caster, else skip if long CD)
-        if (DoCastCCSpells())
-            return;
-
-        // Priority 3: Ranged offensive spells
-        if (DoCastRangedOffensiveSpells())
-            return;
-
-        // Priority 4: Buff allies
-        if (DoCastAllyBuffs())
-            return;
-
-        // Priority 5: Self buffs
-        if (DoCastSelfBuffs())
-            return;
-
-        // Priority 6: Debuffs on current target
-        DoCastDebuffSpells();
-
-        // Fallback: melee if enemy is close
-        DoMeleeAttackIfReady();
-        DoCastOffensiveSpells();
+        // Emergency heals, CC, ranged damage, buffs, debuffs, then melee
+        // and any damage spell as a fallback
+        RunCombatDecision();
     }
 
 
-    void UpdateTankAI(uint32 /*diff*/)
+    // Put the tank ahead on `enemy`'s threat list. With TankThreat.Delta off
+    // this is the old flat top-up of our own list, kept so both paths can be
+    // compared through the threat counters in .capture debug stats.
+    void PullThreat(Unit* enemy, float legacyAmount)
     {
-        DoMeleeAttackIfReady();
-
-        if (_owner)
+        if (!config.tankThreatDelta)
         {
-            // Collect ally GUIDs (owner + all active guardians except self)
-            std::vector<ObjectGuid> allyGuids;
-            allyGuids.push_back(_owner->GetGUID());
-
-            CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-            for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
-            {
-                GuardianSlotData& s = data->slots[i];
-                if (s.IsActive() && s.guardianGuid != me->GetGUID())
-                    allyGuids.push_back(s.guardianGuid);
-            }
-
-            // For every enemy on our threat list, check if it's attacking an ally
-            // and inject threat to pull it off them
-            Unit* tauntTarget = nullptr;
-            for (auto const& ref : me->GetThreatMgr().GetThreatList())
-            {
-                Unit* enemy = ref->getTarget();
-                if (!enemy)
-                    continue;
-
-                Unit* enemyVictim = enemy->GetVictim();
-                if (!enemyVictim || enemyVictim == me)
-                    continue;
-
-                for (ObjectGuid const& allyGuid : allyGuids)
-                {
-                    if (enemyVictim->GetGUID() == allyGuid)
-                    {
-                        // Inject enough threat to overtake the current top holder
-                        me->AddThreat(enemy, 100.0f);
-
-                        // Remember the first enemy attacking an ally for taunt
-                        if (!tauntTarget)
-                            tauntTarget = enemy;
-                        break;
-                    }
-                }
-            }
-
-            // Simulated taunt: if an enemy is still attacking an ally and we have
-            // no player-taught taunt spell, force the enemy to target us periodically
-            if (tauntTarget && !_hasTauntSpell && _tauntTimer <= 0 &&
-                tauntTarget->IsCreature() && tauntTarget->CanHaveThreatList())
-            {
-                tauntTarget->TauntApply(me);
-                me->AddThreat(tauntTarget, 500.0f);
-                _tauntTimer = 8000;
-
-                // Switch to attacking the taunted target
-                AttackStart(tauntTarget);
-            }
+            me->AddThreat(enemy, legacyAmount);
+            metrics.threatMutations.fetch_add(1, std::memory_order_relaxed);
+            return;
         }
-
-        DoCastSelfBuffs();
-        if (DoCastCCSpells()) return;
-        DoCastOffensiveSpells();
+        _threat.Maintain(me, enemy, GameTime::GetGameTimeMS().count());
     }
 
-    void UpdateHealerAI(uint32 /*diff*/)
+    void UpdateTankAI(uint32 diff)
     {
-        // Priority 1: Heal owner/self/allies if needed
-        if (DoCastHealingSpells())
-            return;
-
-        // Priority 2: Dispel debuffs from allies
-        if (DoCastDispelSpells())
-            return;
-
-        // Priority 3: Buff allies (owner + other guardians)
-        if (DoCastAllyBuffs())
-            return;
-
-        // Priority 4: Maintain self buffs
-        if (DoCastSelfBuffs())
-            return;
-
-        // Priority 5: Debuff current target
-        if (DoCastDebuffSpells())
-            return;
-
-        // Priority 6: Conservative attack — prefer ranged if available, else melee
-        if (_preferredRange > 5.0f && DoCastFreeOffensiveSpells(true))
-            return;
-
+        CC_PROFILE_ZONE("CapturedGuardianAI::UpdateTankAI");
+        CC_PROFILE_ANNOTATE(me->GetEntry(), _archetype);
+        metrics.tankActiveMs.fetch_add(diff, std::memory_order_relaxed);
         DoMeleeAttackIfReady();
-        DoCastFreeOffensiveSpells();
 
-        // Priority 7: Heal player-targeted friendly injured NPC (lowest priority)
-        DoCastTargetedNPCHeal();
+        // Pull every enemy on the owner or another guardian and taunt the
+        // first one, then self buffs, CC and damage
+        RunCombatDecision();
     }
 
-    // Lowest-priority healer action: heal a friendly injured NPC the player has targeted.
-    // Only triggers when no higher-priority heal target exists and the player's selection
-    // is a non-guardian creature that is friendly and below full HP.
-    bool DoCastTargetedNPCHeal()
+    void UpdateHealerAI(uint32 /*diff*/)
     {
-        if (me->HasUnitState(UNIT_STATE_CASTING) || !_owner)
-            return false;
-
-        Unit* selected = _owner->GetSelectedUnit();
-        if (!selected || !selected->IsAlive())
-            return false;
-
-        // Must be a creature, not a player
-        Creature* npc = selected->ToCreature();
-        if (!npc)
-            return false;
-
-        // Skip captured guardians — already handled by DoCastHealingSpells
-        if (npc->GetOwnerGUID() == _owner->GetGUID())
-            return false;
-
-        // Must be friendly and actually injured — check from owner's perspective,
-        // since the guardian's faction may differ from the player's
-        if (!_owner->IsFriendlyTo(npc))
-            return false;
-
-        if (npc->IsFullHealth())
-            return false;
+        CC_PROFILE_ZONE("CapturedGuardianAI::UpdateHealerAI");
+        CC_PROFILE_ANNOTATE(me->GetEntry(), _archetype);
+        // Heals, dispels, ally and self buffs, debuffs, free damage spells
+        // (ranged first when standing off), then a player-targeted NPC heal
+        RunCombatDecision();
+    }
 
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+    static bool IsCastingCC(Unit* u)
+    {
+        for (int t = CURRENT_GENERIC_SPELL; t <= CURRENT_CHANNELED_SPELL; ++t)
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId) continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo) continue;
-
-            bool isDirectHeal = spellInfo->IsPositive() && (
-                spellInfo->HasEffect(SPELL_EFFECT_HEAL) ||
-                spellInfo->HasEffect(SPELL_EFFECT_HEAL_PCT) ||
-                spellInfo->HasEffect(SPELL_EFFECT_HEAL_MAX_HEALTH));
-            bool isHoT        = spellInfo->IsPositive() && spellInfo->HasAura(SPELL_AURA_PERIODIC_HEAL);
-            bool isShield     = spellInfo->IsPositive() && spellInfo->HasAura(SPELL_AURA_SCHOOL_ABSORB);
-            if (!isDirectHeal && !isHoT && !isShield)
-                continue;
-
-            if (me->HasSpellCooldown(spellId))
-                continue;
-
-            if ((isHoT || isShield) && npc->HasAura(spellId, me->GetGUID()))
-                continue;
-
-            float maxRange = spellInfo->GetMaxRange(true);
-            if (maxRange > 0.0f && !me->IsWithinDist(npc, maxRange))
-                continue;
-
-            if (!me->IsWithinLOSInMap(npc))
-                continue;
-
-            me->CastSpell(npc, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            return true;
+            Spell* sp = u->GetCurrentSpell(CurrentSpellTypes(t));
+            if (!sp) continue;
+            SpellInfo const* si = sp->GetSpellInfo();
+            if (si && !si->IsPositive() && IsCCSpell(si))
+                return true;
         }
-
         return false;
     }
 
-    void DoCastOffensiveSpells()
+    // Add `u` to the snapshot (once; a second add only merges flags) with the
+    // per-spell bits the decide step needs for it. Returns its index, or -1
+    // when the snapshot is full.
+    int8 AddSnapUnit(GuardianSnapshot& snap, Unit* u, uint16 flags, bool hostile)
     {
-        if (me->HasUnitState(UNIT_STATE_CASTING))
-            return;
-
-        Unit* target = me->GetVictim();
-        if (!target)
-            return;
-
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        for (int8 k = 0; k < snap.unitCount; ++k)
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId)
-                continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo || !spellInfo->CanBeUsedInCombat())
-                continue;
-
-            if (spellInfo->IsPositive())
-                continue;
+            if (snap.units[k].guid == u->GetGUID())
+            {
+                snap.units[k].flags |= flags;
+                return k;
+            }
+        }
+        if (snap.unitCount >= MAX_SNAP_UNITS)
+            return -1;
 
-            if (IsCCSpell(spellInfo))
-                continue;
+        GuardianSnapUnit& su = snap.units[snap.unitCount];
+        su.guid      = u->GetGUID();
+        su.health    = u->GetHealth();
+        su.maxHealth = u->GetMaxHealth();
+        su.flags     = flags;
 
-            if (me->HasSpellCooldown(spellId))
+        for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        {
+            uint8 bit = uint8(1u << i);
+            if (!(snap.ready & bit))
                 continue;
 
-            if (spellInfo->GetMaxRange(false) > 0 &&
-                !me->IsWithinDistInMap(target, spellInfo->GetMaxRange(false)))
+            uint32 spellId = _spellSlots[i];
+            uint16 plan    = _plan.flags[i];
+            if (hostile)
+            {
+                if (_plan.maxRange[i] <= 0.0f || me->IsWithinDistInMap(u, _plan.maxRange[i]))
+                    su.inRange |= bit;
+                if (_plan.minRange[i] > 0.0f && me->IsWithinDistInMap(u, _plan.minRange[i]))
+                    su.inMinRange |= bit;
+                if ((plan & (SPELL_PLAN_PERIODIC | SPELL_PLAN_DEBUFF)) && u->HasAura(spellId, me->GetGUID()))
+                    su.ownAura |= bit;
                 continue;
+            }
 
-            bool isPeriodic = spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE) ||
-                              spellInfo->HasAura(SPELL_AURA_PERIODIC_LEECH) ||
-                              spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE_PERCENT);
-            if (isPeriodic && target->HasAura(spellId, me->GetGUID()))
-                continue;
+            if (_plan.maxRangeFriendly[i] <= 0.0f || me->IsWithinDist(u, _plan.maxRangeFriendly[i]))
+                su.inRange |= bit;
+            if ((plan & (SPELL_PLAN_HOT | SPELL_PLAN_SHIELD)) && u->HasAura(spellId, me->GetGUID()))
+                su.ownAura |= bit;
+            if ((plan & SPELL_PLAN_AURA) && u->HasAura(spellId))
+                su.anyAura |= bit;
 
-            me->CastSpell(target, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            break;
+            // Only healers dispel, and only in combat
+            if ((plan & SPELL_PLAN_DISPEL) && _archetype == ARCHETYPE_HEALER && !snap.outOfCombat)
+            {
+                DispelChargesList list;
+                u->GetDispellableAuraList(me, SpellInfo::GetDispelMask(DispelType(_plan.dispelType[i])), list,
+                    sSpellMgr->GetSpellInfo(spellId));
+                if (!list.empty())
+                    su.dispellable |= bit;
+            }
         }
+        return static_cast<int8>(snap.unitCount++);
     }
 
-    bool DoCastRangedOffensiveSpells()
+    // Tanks: every enemy on our threat list that is attacking the owner or
+    // another guardian gets pulled; the first is the taunt candidate.
+    void CaptureThreat(GuardianSnapshot& snap)
     {
-        if (me->HasUnitState(UNIT_STATE_CASTING))
-            return false;
+        if (!_owner)
+            return;
 
-        Unit* target = me->GetVictim();
-        if (!target)
-            return false;
+        // Collect ally GUIDs (owner + all active guardians except self)
+        ObjectGuid allyGuids[MAX_GUARDIAN_SLOTS + 1];
+        uint8 allyCount = 0;
+        allyGuids[allyCount++] = _owner->GetGUID();
 
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        CapturedGuardianData* data = GetGuardianData(_owner);
+        for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId)
-                continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo || !spellInfo->CanBeUsedInCombat())
-                continue;
-
-            if (spellInfo->IsPositive())
-                continue;
-
-            if (IsCCSpell(spellInfo))
-                continue;
-
-            // Only cast ranged spells in this pass
-            if (!IsRangedSpell(spellInfo))
-                continue;
+            GuardianSlotData& s = data->slots[i];
+            if (s.IsActive() && s.guardianGuid != me->GetGUID())
+                allyGuids[allyCount++] = s.guardianGuid;
+        }
 
-            if (me->HasSpellCooldown(spellId))
-                continue;
+        for (auto const& ref : me->GetThreatMgr().GetThreatList())
+        {
+            if (snap.pullCount >= MAX_SNAP_PULLS)
+                break;
 
-            if (!me->IsWithinDistInMap(target, spellInfo->GetMaxRange(false)))
+            Unit* enemy = ref->getTarget();
+            if (!enemy)
                 continue;
 
-            // Skip if target is inside spell's minimum range
-            float minRange = spellInfo->GetMinRange(false);
-            if (minRange > 0.0f && me->IsWithinDistInMap(target, minRange))
+            Unit* enemyVictim = enemy->GetVictim();
+            if (!enemyVictim || enemyVictim == me)
                 continue;
 
-            bool isPeriodic = spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE) ||
-                              spellInfo->HasAura(SPELL_AURA_PERIODIC_LEECH) ||
-                              spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE_PERCENT);
-            if (isPeriodic && target->HasAura(spellId, me->GetGUID()))
+            if (std::find(allyGuids, allyGuids + allyCount, enemyVictim->GetGUID()) == allyGuids + allyCount)
                 continue;
 
-            me->CastSpell(target, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            return true;
+            snap.pulls[snap.pullCount++] = enemy->GetGUID();
+            if (snap.taunt < 0)
+            {
+                uint16 flags = (enemy->IsCreature() && enemy->CanHaveThreatList()) ? SNAP_UNIT_TAUNTABLE : 0;
+                snap.taunt = AddSnapUnit(snap, enemy, flags, true);
+            }
         }
-
-        return false;
     }
 
-    bool DoCastFreeOffensiveSpells(bool rangedOnly = false)
+    // Enemies on our threat list that are casting, in threat order, for CC
+    void CaptureCasters(GuardianSnapshot& snap)
     {
-        if (me->HasUnitState(UNIT_STATE_CASTING))
-            return false;
-
-        Unit* target = me->GetVictim();
-        if (!target)
-            return false;
-
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        uint8 casters = 0;
+        for (auto const& ref : me->GetThreatMgr().GetThreatList())
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId)
-                continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo || !spellInfo->CanBeUsedInCombat())
-                continue;
-
-            if (spellInfo->IsPositive())
-                continue;
-
-            if (IsCCSpell(spellInfo))
-                continue;
-
-            if (!IsFreeCostSpell(spellInfo))
-                continue;
-
-            if (rangedOnly && !IsRangedSpell(spellInfo))
-                continue;
-
-            if (me->HasSpellCooldown(spellId))
-                continue;
-
-            if (spellInfo->GetMaxRange(false) > 0 &&
-                !me->IsWithinDistInMap(target, spellInfo->GetMaxRange(false)))
-                continue;
-
-            // Skip if target is inside spell's minimum range
-            float minRange = spellInfo->GetMinRange(false);
-            if (minRange > 0.0f && me->IsWithinDistInMap(target, minRange))
+            Unit* enemy = ref->getTarget();
+            if (!enemy || !enemy->IsAlive() || !me->IsValidAttackTarget(enemy))
                 continue;
-
-            bool isPeriodic = spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE) ||
-                              spellInfo->HasAura(SPELL_AURA_PERIODIC_LEECH) ||
-                              spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE_PERCENT);
-            if (isPeriodic && target->HasAura(spellId, me->GetGUID()))
+            if (!enemy->IsNonMeleeSpellCast(false))
                 continue;
 
-            me->CastSpell(target, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            return true;
-        }
-
-        return false;
+            uint16 flags = SNAP_UNIT_CASTING | (IsCastingCC(enemy) ? SNAP_UNIT_CASTING_CC : 0);
+            if (AddSnapUnit(snap, enemy, flags, true) < 0 || ++casters >= MAX_SNAP_CASTERS)
+                break;
+        }
     }
 
-    // DPS emergency heals: cast healing spells on self or fellow guardians below threshold.
-    // Pass includeOwner=true (out-of-combat) to also heal the player.
-    bool DoCastEmergencyHeals(float threshold = 35.0f, bool includeOwner = false)
+    // Read everything DecideGuardian needs for this archetype. Called on a
+    // fresh snapshot.
+    void CaptureGuardianSnapshot(GuardianSnapshot& snap, bool outOfCombat)
     {
-        if (me->HasUnitState(UNIT_STATE_CASTING))
-            return false;
-
-        Unit* healTarget = nullptr;
-        float lowestPct  = threshold;
-
-        auto Check = [&](Unit* u)
+        CC_PROFILE_ZONE("CapturedGuardianAI::CaptureGuardianSnapshot");
+        snap.guardian     = me->GetGUID();
+        snap.archetype    = _archetype;
+        snap.rangedStance = _preferredRange > 5.0f && (_rangedDps || _archetype == ARCHETYPE_HEALER);
+        snap.outOfCombat  = outOfCombat;
+        snap.casting      = me->HasUnitState(UNIT_STATE_CASTING);
+        snap.tauntReady   = !_plan.hasTaunt && _tauntTimer <= 0;
+        snap.plan         = _plan;
+
+        bool hasCC = false;
+        for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
         {
-            if (!u || !u->IsAlive()) return;
-            float pct = u->GetHealthPct();
-            if (pct < lowestPct)
+            uint32 spellId = _spellSlots[i];
+            SpellInfo const* spellInfo = spellId ? sSpellMgr->GetSpellInfo(spellId) : nullptr;
+            if (!spellInfo || me->HasSpellCooldown(spellId))
+                continue;
+
+            snap.ready |= uint8(1u << i);
+            if (_plan.flags[i] & SPELL_PLAN_CC)
             {
-                lowestPct  = pct;
-                healTarget = u;
+                hasCC = true;
+                uint32 cd = std::max({spellInfo->RecoveryTime,
+                                      spellInfo->CategoryRecoveryTime,
+                                      spellInfo->StartRecoveryTime});
+                if (cd > 10000)
+                    snap.ccLongCooldown |= uint8(1u << i);
             }
-        };
+        }
 
-        Check(me);
-        if (_owner)
+        if (_archetype == ARCHETYPE_TANK && !outOfCombat)
+            CaptureThreat(snap);
+        if (snap.casting)
+            return;
+
+        snap.self = AddSnapUnit(snap, me, SNAP_UNIT_SELF | SNAP_UNIT_GUARDIAN, false);
+        if (_owner && _archetype != ARCHETYPE_TANK)
         {
-            if (includeOwner)
-                Check(_owner);
-            CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+            if (_owner->IsAlive())
+                AddSnapUnit(snap, _owner, SNAP_UNIT_OWNER, false);
+            // The pet is only a dispel target
+            Pet* pet = _archetype == ARCHETYPE_HEALER ? _owner->GetPet() : nullptr;
+            if (pet && pet->IsAlive())
+                AddSnapUnit(snap, pet, SNAP_UNIT_PET, false);
+
+            CapturedGuardianData* data = GetGuardianData(_owner);
             for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
             {
                 GuardianSlotData& s = data->slots[i];
                 if (!s.IsActive() || s.guardianGuid == me->GetGUID())
                     continue;
-                Check(ObjectAccessor::GetCreature(*me, s.guardianGuid));
+                Creature* ally = ObjectAccessor::GetCreature(*me, s.guardianGuid);
+                if (!ally || !ally->IsAlive())
+                    continue;
+                uint16 flags = SNAP_UNIT_GUARDIAN | (me->IsWithinDistInMap(ally, 30.0f) ? SNAP_UNIT_NEAR : 0);
+                AddSnapUnit(snap, ally, flags, false);
             }
         }
 
-        if (!healTarget)
-            return false;
-
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        if (_archetype == ARCHETYPE_HEALER)
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId) continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo) continue;
+            if (Unit* npc = GetHealableSelection())
+                AddSnapUnit(snap, npc, SNAP_UNIT_NPC, false);
+            CaptureHealSnapshot(snap.heal, outOfCombat);
+        }
 
-            bool isDirectHeal = spellInfo->IsPositive() && (
-                spellInfo->HasEffect(SPELL_EFFECT_HEAL) ||
-                spellInfo->HasEffect(SPELL_EFFECT_HEAL_PCT) ||
-                spellInfo->HasEffect(SPELL_EFFECT_HEAL_MAX_HEALTH));
-            bool isHoT        = spellInfo->IsPositive() && spellInfo->HasAura(SPELL_AURA_PERIODIC_HEAL);
-            bool isShield     = spellInfo->IsPositive() && spellInfo->HasAura(SPELL_AURA_SCHOOL_ABSORB);
-            if (!isDirectHeal && !isHoT && !isShield)
-                continue;
+        if (outOfCombat)
+            return;
 
-            if (me->HasSpellCooldown(spellId))
-                continue;
+        if (Unit* victim = me->GetVictim())
+            snap.victim = AddSnapUnit(snap, victim, SNAP_UNIT_VICTIM, true);
+        if (hasCC)
+            CaptureCasters(snap);
+    }
 
-            if ((isHoT || isShield) && healTarget->HasAura(spellId, me->GetGUID()))
-                continue;
+    // A friendly, injured, non-guardian creature the owner has selected:
+    // the healer's lowest-priority heal target. The owner's view of it is
+    // used since the guardian's faction may differ from the player's.
+    Unit* GetHealableSelection() const
+    {
+        if (!_owner)
+            return nullptr;
 
-            float maxRange = spellInfo->GetMaxRange(true);
-            if (maxRange > 0.0f && !me->IsWithinDist(healTarget, maxRange))
-                continue;
-            if (!me->IsWithinLOSInMap(healTarget))
-                continue;
+        Unit* selected = _owner->GetSelectedUnit();
+        if (!selected || !selected->IsAlive())
+            return nullptr;
 
-            me->CastSpell(healTarget, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            return true;
-        }
+        Creature* npc = selected->ToCreature();
+        if (!npc || npc->GetOwnerGUID() == _owner->GetGUID())
+            return nullptr;
 
-        return false;
+        if (!_owner->IsFriendlyTo(npc) || npc->IsFullHealth())
+            return nullptr;
+        return npc;
     }
 
-    // Cast the best available healing spell on target.
-    // shieldsFirst: do a shield-only pass before the general heal pass (used for critical player).
-    bool TryCastHealSpellOn(Unit* target, bool shieldsFirst)
+    // Add `u` to the snapshot's candidates (once) with its per-spell range and
+    // own-aura bits. Returns its index.
+    int8 AddHealCandidate(HealSnapshot& snap, Unit* u)
     {
-        int numPasses = shieldsFirst ? 2 : 1;
-        for (int pass = 0; pass < numPasses; ++pass)
-        {
-            for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
-            {
-                uint32 spellId = _spellSlots[i];
-                if (!spellId) continue;
-
-                SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-                if (!spellInfo) continue;
-
-                bool isDirectHeal = spellInfo->IsPositive() && (
-                    spellInfo->HasEffect(SPELL_EFFECT_HEAL) ||
-                    spellInfo->HasEffect(SPELL_EFFECT_HEAL_PCT) ||
-                    spellInfo->HasEffect(SPELL_EFFECT_HEAL_MAX_HEALTH));
-                bool isHoT        = spellInfo->IsPositive() && spellInfo->HasAura(SPELL_AURA_PERIODIC_HEAL);
-                bool isShield     = spellInfo->IsPositive() && spellInfo->HasAura(SPELL_AURA_SCHOOL_ABSORB);
-                if (!isDirectHeal && !isHoT && !isShield)
-                    continue;
-
-                if (shieldsFirst && pass == 0 && !isShield) continue;
-                if (shieldsFirst && pass == 1 && isShield)  continue;
-
-                if (me->HasSpellCooldown(spellId))
-                    continue;
-
-                if ((isHoT || isShield) && target->HasAura(spellId, me->GetGUID()))
-                    continue;
+        for (uint8 k = 0; k < snap.candidateCount; ++k)
+            if (snap.candidates[k].guid == u->GetGUID())
+                return static_cast<int8>(k);
 
-                float maxRange = spellInfo->GetMaxRange(true);
-                if (maxRange > 0.0f && !me->IsWithinDist(target, maxRange))
-                    continue;
-                if (!me->IsWithinLOSInMap(target))
-                    continue;
+        HealCandidate& c = snap.candidates[snap.candidateCount];
+        c.guid      = u->GetGUID();
+        c.health    = u->GetHealth();
+        c.maxHealth = u->GetMaxHealth();
+        for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        {
+            if (!(snap.ready & (1u << i)))
+                continue;
 
-                me->CastSpell(target, spellId, false);
-                ApplySpellCooldown(spellId, spellInfo);
-                return true;
-            }
+            float maxRange = _plan.maxRangeFriendly[i];
+            if (maxRange <= 0.0f || me->IsWithinDist(u, maxRange))
+                c.inRange |= uint8(1u << i);
+            if (snap.estimates[i].leavesAura && u->HasAura(snap.spellIds[i], me->GetGUID()))
+                c.hasOwnAura |= uint8(1u << i);
         }
-        return false;
+        return static_cast<int8>(snap.candidateCount++);
     }
 
+    // Read everything DecideHeal needs. Only the phase targets (at most three)
+    // get per-spell checks, as when the heal pass ran inline.
     // outOfCombat: phase-3 threshold widens from 50% to 90%.
-    bool DoCastHealingSpells(bool outOfCombat = false)
+    void CaptureHealSnapshot(HealSnapshot& snap, bool outOfCombat)
     {
-        if (me->HasUnitState(UNIT_STATE_CASTING))
-            return false;
+        if (_healEstimateLevel != me->GetLevel())
+            RebuildHealEstimates();
 
-        // Phase 1: player critically low (< 25%) — shields first, then heals
-        if (_owner && _owner->IsAlive() && _owner->GetHealthPct() < 25.0f)
+        snap = HealSnapshot();
+        for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
         {
-            if (TryCastHealSpellOn(_owner, /*shieldsFirst=*/true))
-                return true;
+            uint32 spellId = _spellSlots[i];
+            HealEstimate const& est = _healEstimates[i];
+            snap.spellIds[i]  = spellId;
+            snap.estimates[i] = est;
+            if (!spellId || est.kind == HEAL_KIND_NONE)
+                continue;
+            if (me->HasSpellCooldown(spellId) || !sSpellMgr->GetSpellInfo(spellId))
+                continue;
+            snap.ready   |= uint8(1u << i);
+            snap.power[i] = me->GetPower(Powers(est.powerType));
         }
 
+        // Phase 1: player critically low (< 25%) — shields first, then heals
+        if (_owner && _owner->IsAlive() && _owner->GetHealthPct() < 25.0f)
+            snap.phaseTarget[HEAL_PHASE_OWNER] = AddHealCandidate(snap, _owner);
+
         // Phase 2: tank guardians below 70%
         if (_owner)
         {
             Unit* tankTarget  = nullptr;
             float lowestTank  = 70.0f;
-            CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+            CapturedGuardianData* data = GetGuardianData(_owner);
             for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
             {
                 GuardianSlotData& s = data->slots[i];
@@ -1944,8 +4345,8 @@ private:
                 float pct = ally->GetHealthPct();
                 if (pct < lowestTank) { lowestTank = pct; tankTarget = ally; }
             }
-            if (tankTarget && TryCastHealSpellOn(tankTarget, false))
-                return true;
+            if (tankTarget)
+                snap.phaseTarget[HEAL_PHASE_TANK] = AddHealCandidate(snap, tankTarget);
         }
 
         // Phase 3: everyone else — 50% in combat, 90% out of combat
@@ -1966,7 +4367,7 @@ private:
             {
                 Check(_owner);
                 Check(_owner->GetPet());
-                CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+                CapturedGuardianData* data = GetGuardianData(_owner);
                 for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
                 {
                     GuardianSlotData& s = data->slots[i];
@@ -1976,331 +4377,183 @@ private:
             }
 
             if (healTarget)
-                return TryCastHealSpellOn(healTarget, false);
-        }
-
-        return false;
-    }
-
-    bool DoCastDispelSpells()
-    {
-        if (me->HasUnitState(UNIT_STATE_CASTING) || !_owner)
-            return false;
-
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
-        {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId) continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo || !spellInfo->IsPositive()) continue;
-            if (me->HasSpellCooldown(spellId)) continue;
-
-            // Identify SPELL_EFFECT_DISPEL and its type
-            uint32 dispelType = DISPEL_NONE;
-            for (uint8 eff = 0; eff < MAX_SPELL_EFFECTS; ++eff)
-            {
-                if (spellInfo->Effects[eff].Effect == SPELL_EFFECT_DISPEL)
-                {
-                    dispelType = spellInfo->Effects[eff].MiscValue;
-                    break;
-                }
-            }
-            if (dispelType == DISPEL_NONE) continue;
-
-            uint32 dispelMask = SpellInfo::GetDispelMask(DispelType(dispelType));
-
-            // Priority: owner > pet > fellow guardians > self
-            Unit* dispelTarget = nullptr;
-
-            auto TryTarget = [&](Unit* u)
-            {
-                if (dispelTarget || !u || !u->IsAlive()) return;
-                DispelChargesList list;
-                u->GetDispellableAuraList(me, dispelMask, list, spellInfo);
-                if (!list.empty())
-                    dispelTarget = u;
-            };
-
-            TryTarget(_owner);
-            if (!dispelTarget)
-            {
-                TryTarget(_owner->GetPet());
-                CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-                for (uint8 j = 0; j < MAX_GUARDIAN_SLOTS && !dispelTarget; ++j)
-                {
-                    GuardianSlotData& s = data->slots[j];
-                    if (!s.IsActive()) continue;
-                    TryTarget(ObjectAccessor::GetCreature(*me, s.guardianGuid));
-                }
-                TryTarget(me);
-            }
-
-            if (!dispelTarget) continue;
-
-            float maxRange = spellInfo->GetMaxRange(true);
-            if (maxRange > 0.0f && !me->IsWithinDist(dispelTarget, maxRange))
-                continue;
-            if (!me->IsWithinLOSInMap(dispelTarget))
-                continue;
-
-            me->CastSpell(dispelTarget, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            return true;
+                snap.phaseTarget[HEAL_PHASE_ANY] = AddHealCandidate(snap, healTarget);
         }
-        return false;
     }
 
-    bool DoCastSelfBuffs()
+    // Cast one action if it is still valid. The decision may be a tick old,
+    // so target, cooldown, range, power and LOS are checked again here.
+    bool TryApplyAction(GuardianAction const& a)
     {
         if (me->HasUnitState(UNIT_STATE_CASTING))
             return false;
 
-        bool cast = false;
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
-        {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId)
-                continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo)
-                continue;
-
-            if (!spellInfo->IsPositive() || IsHealingSpell(spellInfo))
-                continue;
-
-            if (me->HasAura(spellId))
-                continue;
-
-            if (me->HasSpellCooldown(spellId))
-                continue;
-
-            me->CastSpell(me, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            cast = true;
-            break;
-        }
-        return cast;
-    }
-
-    bool DoCastAllyBuffs()
-    {
-        if (me->HasUnitState(UNIT_STATE_CASTING) || !_owner)
+        uint32 spellId = _spellSlots[a.slot];
+        if (!spellId || spellId != a.spellId || me->HasSpellCooldown(spellId))
             return false;
 
-        // Collect allies: owner + other active guardians
-        std::vector<Unit*> allies;
-        if (_owner->IsAlive())
-            allies.push_back(_owner);
-
-        CapturedGuardianData* data = _owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-        for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
-        {
-            GuardianSlotData& s = data->slots[i];
-            if (!s.IsActive() || s.guardianGuid == me->GetGUID())
-                continue;
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+        if (!spellInfo)
+            return false;
 
-            Creature* ally = ObjectAccessor::GetCreature(*me, s.guardianGuid);
-            if (ally && ally->IsAlive() && me->IsWithinDistInMap(ally, 30.0f))
-                allies.push_back(ally);
-        }
+        Unit* target = a.target == me->GetGUID() ? me : ObjectAccessor::GetUnit(*me, a.target);
+        if (!target || !target->IsAlive())
+            return false;
 
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        switch (a.step)
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId)
-                continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo || !spellInfo->IsPositive())
-                continue;
-
-            // Skip heals — those are handled by DoCastHealingSpells
-            if (IsHealingSpell(spellInfo))
-                continue;
-
-            // Must have an aura component to be a buff
-            bool hasBuff = false;
-            for (uint8 eff = 0; eff < MAX_SPELL_EFFECTS; ++eff)
+            case STEP_HEAL:
+            case STEP_EMERGENCY_HEAL:
+            case STEP_DISPEL:
+            case STEP_NPC_HEAL:
             {
-                if (spellInfo->Effects[eff].IsAura())
+                if (a.step == STEP_HEAL)
                 {
-                    hasBuff = true;
-                    break;
+                    HealEstimate const& est = _healEstimates[a.slot];
+                    if (est.cost > me->GetPower(Powers(est.powerType)))
+                        return false;
                 }
+                float maxRange = _plan.maxRangeFriendly[a.slot];
+                if (maxRange > 0.0f && !me->IsWithinDist(target, maxRange))
+                    return false;
+                if (!me->IsWithinLOSInMap(target))
+                    return false;
+                break;
             }
-            if (!hasBuff)
-                continue;
-
-            if (me->HasSpellCooldown(spellId))
-                continue;
-
-            // Find an ally missing this buff
-            for (Unit* ally : allies)
+            case STEP_ALLY_BUFF:
+            case STEP_SELF_BUFF:
+                if (target->HasAura(spellId))
+                    return false;
+                break;
+            case STEP_CC:
             {
-                if (ally->HasAura(spellId))
-                    continue;
-
-                me->CastSpell(ally, spellId, false);
-                ApplySpellCooldown(spellId, spellInfo);
-                return true;
+                float maxRange = _plan.maxRange[a.slot];
+                if (maxRange > 0.0f && !me->IsWithinDist(target, maxRange))
+                    return false;
+                if (!me->IsWithinLOSInMap(target))
+                    return false;
+                break;
+            }
+            default:
+            {
+                // Debuffs and damage only go on the current victim
+                if (target != me->GetVictim())
+                    return false;
+                float maxRange = _plan.maxRange[a.slot];
+                if (maxRange > 0.0f && !me->IsWithinDistInMap(target, maxRange))
+                    return false;
+                float minRange = _plan.minRange[a.slot];
+                if (a.step != STEP_OFFENSIVE && a.step != STEP_DEBUFF &&
+                    minRange > 0.0f && me->IsWithinDistInMap(target, minRange))
+                    return false;
+                break;
             }
         }
-        return false;
+
+        me->CastSpell(target, spellId, false);
+        ApplySpellCooldown(spellId, spellInfo);
+        return true;
     }
 
-    // Returns the first hostile unit in the threat list that is actively casting.
-    // ccCastersOnly=true  → only units casting a stun/fear/confuse/interrupt spell.
-    // ccCastersOnly=false → any unit casting a non-melee spell (interruptible).
-    Unit* FindCastingEnemy(float maxRange, bool ccCastersOnly)
+    // Pull and taunt first, then walk the actions: the first one of each step
+    // that casts ends that step, and a terminal step that casts ends the chain.
+    // Returns true if anything was cast.
+    bool ApplyGuardianDecision(GuardianDecision const& d)
     {
-        auto IsCastingCC = [](Unit* u) -> bool
-        {
-            for (int t = CURRENT_GENERIC_SPELL; t <= CURRENT_CHANNELED_SPELL; ++t)
-            {
-                Spell* sp = u->GetCurrentSpell(CurrentSpellTypes(t));
-                if (!sp) continue;
-                SpellInfo const* si = sp->GetSpellInfo();
-                if (si && !si->IsPositive() && IsCCSpell(si))
-                    return true;
-            }
-            return false;
-        };
-
-        for (auto const& ref : me->GetThreatMgr().GetThreatList())
+        CC_PROFILE_ZONE("CapturedGuardianAI::ApplyGuardianDecision");
+        for (uint8 n = 0; n < d.pullCount; ++n)
         {
-            Unit* enemy = ref->getTarget();
+            Unit* enemy = ObjectAccessor::GetUnit(*me, d.pulls[n]);
             if (!enemy || !enemy->IsAlive())
                 continue;
-            if (maxRange > 0.0f && !me->IsWithinDist(enemy, maxRange))
-                continue;
-            if (!me->IsValidAttackTarget(enemy))
+
+            Unit* enemyVictim = enemy->GetVictim();
+            if (!enemyVictim || enemyVictim == me)
                 continue;
 
-            if (ccCastersOnly)
-            {
-                if (IsCastingCC(enemy))
-                    return enemy;
-            }
-            else
-            {
-                if (enemy->IsNonMeleeSpellCast(false))
-                    return enemy;
-            }
+            // Inject enough threat to overtake the current top holder
+            PullThreat(enemy, 100.0f);
         }
-        return nullptr;
-    }
-
-    bool DoCastCCSpells()
-    {
-        if (me->HasUnitState(UNIT_STATE_CASTING))
-            return false;
-
-        Unit* victim = me->GetVictim();
 
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        // Simulated taunt: if an enemy is still attacking an ally and we have
+        // no player-taught taunt spell, force the enemy to target us periodically
+        if (!d.taunt.IsEmpty() && !_plan.hasTaunt && _tauntTimer <= 0)
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId) continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo || spellInfo->IsPositive()) continue;
-            if (me->HasSpellCooldown(spellId)) continue;
-            if (!IsCCSpell(spellInfo)) continue;
-
-            float maxRange = spellInfo->GetMaxRange(false);
-
-            // Priority 1: enemy actively casting a CC spell (counter their CC)
-            Unit* ccTarget = FindCastingEnemy(maxRange, /*ccCastersOnly=*/true);
-
-            // Priority 2: any enemy casting an interruptible spell
-            if (!ccTarget)
-                ccTarget = FindCastingEnemy(maxRange, /*ccCastersOnly=*/false);
-
-            // Priority 3: no casting targets — only use if cooldown is short (≤ 10s)
-            if (!ccTarget)
+            Unit* tauntTarget = ObjectAccessor::GetUnit(*me, d.taunt);
+            if (tauntTarget && tauntTarget->IsAlive() && tauntTarget->GetVictim() != me &&
+                tauntTarget->IsCreature() && tauntTarget->CanHaveThreatList())
             {
-                uint32 cd = std::max({spellInfo->RecoveryTime,
-                                      spellInfo->CategoryRecoveryTime,
-                                      spellInfo->StartRecoveryTime});
-                if (cd > 10000)
-                    continue;
-                ccTarget = victim;
-            }
-
-            if (!ccTarget) continue;
-
-            if (maxRange > 0.0f && !me->IsWithinDist(ccTarget, maxRange))
-                continue;
-            if (!me->IsWithinLOSInMap(ccTarget))
-                continue;
+                tauntTarget->TauntApply(me);
+                me->AddThreat(tauntTarget, 500.0f);
+                metrics.threatMutations.fetch_add(1, std::memory_order_relaxed);
+                _tauntTimer = 8000;
 
-            me->CastSpell(ccTarget, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            return true;
+                // Switch to attacking the taunted target
+                AttackStart(tauntTarget);
+            }
         }
-        return false;
-    }
-
-    bool DoCastDebuffSpells()
-    {
-        if (me->HasUnitState(UNIT_STATE_CASTING))
-            return false;
-
-        Unit* target = me->GetVictim();
-        if (!target)
-            return false;
 
-        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+        bool cast = false;
+        int16 castStep = -1;
+        for (uint8 n = 0; n < d.actionCount; ++n)
         {
-            uint32 spellId = _spellSlots[i];
-            if (!spellId)
-                continue;
-
-            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-            if (!spellInfo || spellInfo->IsPositive())
-                continue;
-
-            // CC spells are handled exclusively by DoCastCCSpells
-            if (IsCCSpell(spellInfo))
-                continue;
-
-            // Skip direct damage spells — those are handled by DoCastOffensiveSpells
-            if (spellInfo->HasEffect(SPELL_EFFECT_SCHOOL_DAMAGE) ||
-                spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE) ||
-                spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE_NOSCHOOL) ||
-                spellInfo->HasEffect(SPELL_EFFECT_NORMALIZED_WEAPON_DMG))
+            GuardianAction const& a = d.actions[n];
+            if (a.step == castStep)
                 continue;
 
-            // Must have an aura component (debuff)
-            bool hasDebuff = false;
-            for (uint8 eff = 0; eff < MAX_SPELL_EFFECTS; ++eff)
+            if (a.step == STEP_MELEE)
             {
-                if (spellInfo->Effects[eff].IsAura())
-                {
-                    hasDebuff = true;
-                    break;
-                }
-            }
-            if (!hasDebuff)
+                DoMeleeAttackIfReady();
                 continue;
+            }
 
-            if (target->HasAura(spellId, me->GetGUID()))
+            if (!TryApplyAction(a))
                 continue;
 
-            if (me->HasSpellCooldown(spellId))
-                continue;
+            cast = true;
+            castStep = a.step;
+            if (a.terminal)
+                break;
+        }
+        return cast;
+    }
 
-            if (spellInfo->GetMaxRange(false) > 0 &&
-                !me->IsWithinDistInMap(target, spellInfo->GetMaxRange(false)))
-                continue;
+    // In-combat casts and threat. Decided inline from a fresh snapshot, or,
+    // while ParallelAI is active, applied from last tick's batch with a new
+    // snapshot queued for the next one.
+    void RunCombatDecision()
+    {
+        if (me->HasUnitState(UNIT_STATE_CASTING) && _archetype != ARCHETYPE_TANK)
+            return;
 
-            me->CastSpell(target, spellId, false);
-            ApplySpellCooldown(spellId, spellInfo);
-            return true;
+        s_aiBatch.NoteGuardian();
+        if (!s_aiBatch.Active())
+        {
+            GuardianSnapshot snap;
+            CaptureGuardianSnapshot(snap, false);
+            ApplyGuardianDecision(DecideGuardian(snap));
+            return;
         }
-        return false;
+
+        if (GuardianDecision const* decision = s_aiBatch.Find(me->GetGUID()))
+            if (ApplyGuardianDecision(*decision))
+                metrics.aiBatchApplied.fetch_add(1, std::memory_order_relaxed);
+
+        GuardianSnapshot snap;
+        CaptureGuardianSnapshot(snap, false);
+        s_aiBatch.Submit(snap);
+    }
+
+    // Out-of-combat heals run on the 500ms combat-check timer, so they are
+    // always decided inline.
+    void RunIdleDecision()
+    {
+        if (me->HasUnitState(UNIT_STATE_CASTING))
+            return;
+
+        GuardianSnapshot snap;
+        CaptureGuardianSnapshot(snap, true);
+        ApplyGuardianDecision(DecideGuardian(snap));
     }
 
     void ApplySpellCooldown(uint32 spellId, SpellInfo const* spellInfo)
@@ -2326,6 +4579,8 @@ private:
     float _preferredRange;
     float _recoveryRange;   // biggest minRange among ranged spells + 3yd
     uint32 _spellSlots[MAX_GUARDIAN_SPELLS];
+    GuardianSpellPlan _plan;
+    GuardianThreatKeeper _threat;
     int32 _updateTimer;
     int32 _combatCheckTimer;
     int32 _retargetTimer = 500;
@@ -2337,10 +4592,143 @@ private:
     int32 _repositionTimer = 0;
     Position _preRetreatPos;        // guardian position before last retreat
     bool  _retreatPending  = false;
-    bool  _hasTauntSpell;
+    bool  _dormant         = false;
+    uint32 _ownerIdleMs    = 0;
+    Position _ownerIdlePos;         // owner position when the idle clock last reset
     std::vector<ObjectGuid> _summonedGuids;
+
+    HealEstimate _healEstimates[MAX_GUARDIAN_SPELLS];
+    uint8 _healEstimateLevel = 0;
 };
 
+void CapturedGuardianAI::BuildSpellPlan(GuardianSpellPlan& plan, uint32 const* spells)
+{
+    plan = GuardianSpellPlan();
+    memcpy(plan.spellIds, spells, sizeof(plan.spellIds));
+    plan.built = true;
+
+    float smallestMax = 999.0f;
+    float biggestMin  = 0.0f;
+    for (uint8 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+    {
+        SpellInfo const* spellInfo = spells[i] ? sSpellMgr->GetSpellInfo(spells[i]) : nullptr;
+        if (!spellInfo)
+            continue;
+
+        uint16 flags = 0;
+        plan.minRange[i]         = spellInfo->GetMinRange(false);
+        plan.maxRange[i]         = spellInfo->GetMaxRange(false);
+        plan.maxRangeFriendly[i] = spellInfo->GetMaxRange(true);
+
+        if (IsRangedSpell(spellInfo))
+            flags |= SPELL_PLAN_RANGED;
+        if (IsFreeCostSpell(spellInfo))
+            flags |= SPELL_PLAN_FREE;
+        if (spellInfo->HasAura(SPELL_AURA_MOD_TAUNT))
+            flags |= SPELL_PLAN_TAUNT;
+
+        uint32 dispelType = DISPEL_NONE;
+        for (uint8 eff = 0; eff < MAX_SPELL_EFFECTS; ++eff)
+        {
+            if (spellInfo->Effects[eff].IsAura())
+                flags |= SPELL_PLAN_AURA;
+            if (spellInfo->Effects[eff].Effect == SPELL_EFFECT_DISPEL && dispelType == DISPEL_NONE)
+                dispelType = spellInfo->Effects[eff].MiscValue;
+        }
+
+        if (spellInfo->IsPositive())
+        {
+            if (dispelType != DISPEL_NONE)
+            {
+                flags |= SPELL_PLAN_DISPEL;
+                plan.dispelType[i] = uint8(dispelType);
+            }
+            if (spellInfo->HasEffect(SPELL_EFFECT_HEAL) ||
+                spellInfo->HasEffect(SPELL_EFFECT_HEAL_PCT) ||
+                spellInfo->HasEffect(SPELL_EFFECT_HEAL_MAX_HEALTH))
+                flags |= SPELL_PLAN_DIRECT_HEAL;
+            if (spellInfo->HasAura(SPELL_AURA_PERIODIC_HEAL))
+                flags |= SPELL_PLAN_HOT;
+            if (spellInfo->HasAura(SPELL_AURA_SCHOOL_ABSORB))
+                flags |= SPELL_PLAN_SHIELD;
+            if (!IsHealingSpell(spellInfo))
+                flags |= SPELL_PLAN_BUFF;
+
+            if (flags & (SPELL_PLAN_DIRECT_HEAL | SPELL_PLAN_HOT | SPELL_PLAN_SHIELD))
+                plan.heals[plan.healCount++] = i;
+            if (flags & SPELL_PLAN_BUFF)
+                plan.buffs[plan.buffCount++] = i;
+        }
+        else
+        {
+            if (IsCCSpell(spellInfo))
+                flags |= SPELL_PLAN_CC;
+            else
+            {
+                if (spellInfo->CanBeUsedInCombat())
+                {
+                    flags |= SPELL_PLAN_OFFENSIVE;
+                    plan.offensive[plan.offensiveCount++] = i;
+                }
+
+                bool directDamage = spellInfo->HasEffect(SPELL_EFFECT_SCHOOL_DAMAGE) ||
+                                    spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE) ||
+                                    spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE_NOSCHOOL) ||
+                                    spellInfo->HasEffect(SPELL_EFFECT_NORMALIZED_WEAPON_DMG);
+                if (!directDamage && (flags & SPELL_PLAN_AURA))
+                    flags |= SPELL_PLAN_DEBUFF;
+            }
+
+            if (spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE) ||
+                spellInfo->HasAura(SPELL_AURA_PERIODIC_LEECH) ||
+                spellInfo->HasAura(SPELL_AURA_PERIODIC_DAMAGE_PERCENT))
+                flags |= SPELL_PLAN_PERIODIC;
+
+            if (flags & SPELL_PLAN_RANGED)
+            {
+                smallestMax = std::min(smallestMax, plan.maxRange[i]);
+                biggestMin  = std::max(biggestMin, plan.minRange[i]);
+            }
+        }
+
+        // Ranged weapon need: DmgClass ranged, or uses ranged slot, or auto-repeat.
+        // A spell that needs a bow is not also checked for a melee weapon.
+        bool needsRanged = (spellInfo->DmgClass == SPELL_DAMAGE_CLASS_RANGED &&
+                            spellInfo->IsRangedWeaponSpell()) ||
+                           spellInfo->HasAttribute(SPELL_ATTR0_USES_RANGED_SLOT);
+        if (needsRanged)
+            plan.needsRangedWeapon = true;
+        else if (spellInfo->DmgClass == SPELL_DAMAGE_CLASS_MELEE &&
+                 (spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE) ||
+                  spellInfo->HasEffect(SPELL_EFFECT_WEAPON_DAMAGE_NOSCHOOL) ||
+                  spellInfo->HasEffect(SPELL_EFFECT_NORMALIZED_WEAPON_DMG) ||
+                  spellInfo->HasAttribute(SPELL_ATTR3_REQUIRES_MAIN_HAND_WEAPON)))
+            plan.needsMeleeWeapon = true;
+
+        if (flags & SPELL_PLAN_TAUNT)
+            plan.hasTaunt = true;
+
+        plan.flags[i] = flags;
+    }
+
+    if (smallestMax < 999.0f)
+        plan.rangedPreferred = smallestMax * 0.8f; // stay slightly inside max range
+
+    // Recovery range: just past the biggest minimum range so all
+    // ranged spells can fire.  Used for deadzone retreat distance
+    // and for re-engaging at range after melee.
+    plan.rangedRecovery = biggestMin + 3.0f;
+}
+
+// The slot's cached spell plan, rebuilt only when its loadout has changed
+// since the plan was built.
+static GuardianSpellPlan const& GetSlotSpellPlan(GuardianSlotData& s)
+{
+    if (!s.spellPlan.IsBuiltFor(s.spellSlots))
+        CapturedGuardianAI::BuildSpellPlan(s.spellPlan, s.spellSlots);
+    return s.spellPlan;
+}
+
 // ============================================================================
 // Addon Message — Full state helpers (defined after data structures)
 // ============================================================================
@@ -2357,11 +4745,16 @@ static void SendFullSlotState(Player* player, uint8 slot, GuardianSlotData const
     SendGuardianBonuses(player, slot, slotData);
     if (slotData.IsActive())
         SendGuardianGuid(player, slot, slotData.guardianGuid);
+    if (CapturedGuardianData* data = FindGuardianData(player))
+        SendGuardianVersion(player, slot, data->epoch, slotData.version);
 }
 
 static void SendAllSlotsState(Player* player)
 {
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CapturedGuardianData* data = FindGuardianData(player);
+    if (!data)
+        return;
+
     for (uint8 i = 0; i < config.maxSlots; ++i)
     {
         if (data->slots[i].IsOccupied())
@@ -2373,11 +4766,10 @@ static void SendAllSlotsState(Player* player)
 // Addon Message — Bonus stats
 // ============================================================================
 
-static void SendGuardianBonuses(Player* player, uint8 slot, GuardianSlotData const& s)
+// The 21 bonus fields shared by BONUS and FEEDPREVIEW, each ':'-prefixed
+static void AppendBonusFields(std::ostringstream& ss, GuardianSlotData const& s)
 {
-    std::ostringstream ss;
-    ss << ADDON_PREFIX << "\tBONUS:" << (uint32)slot
-       << ":" << s.bonusStrength
+    ss << ":" << s.bonusStrength
        << ":" << s.bonusAgility
        << ":" << s.bonusIntellect
        << ":" << s.bonusStamina
@@ -2398,7 +4790,27 @@ static void SendGuardianBonuses(Player* player, uint8 slot, GuardianSlotData con
        << ":" << s.bonusResFrost
        << ":" << s.bonusResShadow
        << ":" << s.bonusResArcane;
-    SendCaptureAddonMessage(player, ss.str());
+}
+
+static std::string EncodeGuardianBonuses(uint8 slot, GuardianSlotData const& s)
+{
+    std::ostringstream ss;
+    ss << ADDON_PREFIX << "\tBONUS:" << (uint32)slot;
+    AppendBonusFields(ss, s);
+    return ss.str();
+}
+
+static void SendGuardianBonuses(Player* player, uint8 slot, GuardianSlotData const& s)
+{
+    SendCaptureAddonMessage(player, EncodeGuardianBonuses(slot, s));
+}
+
+static std::string EncodeFeedPreview(uint8 slot, uint32 itemEntry, GuardianSlotData const& preview)
+{
+    std::ostringstream ss;
+    ss << ADDON_PREFIX << "\tFEEDPREVIEW:" << (uint32)slot << ":" << itemEntry;
+    AppendBonusFields(ss, preview);
+    return ss.str();
 }
 
 // ============================================================================
@@ -2413,6 +4825,10 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
     if (!owner || !killed)
         return;
 
+    CapturedGuardianData* data = FindGuardianData(owner);
+    if (!data)
+        return;
+
     // Anti-double-roll: skip if we already processed this kill
     uint64 ownerKey = owner->GetGUID().GetRawValue();
     ObjectGuid killedGuid = killed->GetGUID();
@@ -2421,8 +4837,6 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
         return;
     s_lastLeechTarget[ownerKey] = killedGuid;
 
-    CapturedGuardianData* data = owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-
     // Estimate mob's "effective stats" from combat values
     float mobAvgDmg = (killed->GetFloatValue(UNIT_FIELD_MINDAMAGE) +
                        killed->GetFloatValue(UNIT_FIELD_MAXDAMAGE)) / 2.0f;
@@ -2451,6 +4865,7 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
             continue;
 
         bool leeched = false;
+        int32 totalGain = 0;
         std::string msg;
 
         // Leech STR
@@ -2458,6 +4873,7 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
         {
             int32 gain = std::max(1, static_cast<int32>(std::ceil(mobEffStr * leechPct)));
             s.bonusStrength += gain;
+            totalGain += gain;
             leeched = true;
             msg += fmt::format("+{} STR", gain);
         }
@@ -2467,6 +4883,7 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
         {
             int32 gain = std::max(1, static_cast<int32>(std::ceil(mobEffAgi * leechPct)));
             s.bonusAgility += gain;
+            totalGain += gain;
             leeched = true;
             if (!msg.empty()) msg += ", ";
             msg += fmt::format("+{} AGI", gain);
@@ -2477,6 +4894,7 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
         {
             int32 gain = std::max(1, static_cast<int32>(std::ceil(mobEffSta * leechPct)));
             s.bonusStamina += gain;
+            totalGain += gain;
             // Apply STA change via modifier system so percentage auras stay correct
             uint32 hpGain = static_cast<uint32>(gain * 10);
             guardian->SetStatFlatModifier(UNIT_MOD_HEALTH, TOTAL_VALUE,
@@ -2494,6 +4912,7 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
         {
             int32 gain = std::max(1, static_cast<int32>(std::ceil(mobEffInt * leechPct)));
             s.bonusIntellect += gain;
+            totalGain += gain;
             // Apply INT change via modifier system so percentage auras stay correct
             if (guardian->getPowerType() == POWER_MANA)
             {
@@ -2512,12 +4931,15 @@ static void TryLeechFromKill(Player* owner, Creature* killed)
 
         if (leeched)
         {
+            RefreshDerivedStats(s);
+            LogCaptureEvent(CAPTURE_EVENT_LEECH, owner, i, s, uint32(totalGain));
             guardian->CastSpell(guardian, 18499, true);
 
             ChatHandler(owner->GetSession()).PSendSysMessage(
                 "{} leeched: {}", guardian->GetName(), msg);
 
             SendGuardianBonuses(owner, i, s);
+            BumpSlotVersion(owner, i);
             SaveGuardianSlotToDb(owner, &s, i);
         }
     }
@@ -2567,53 +4989,532 @@ static void PopulateDefaultSpells(uint32 creatureEntry, uint32* spells, Creature
     if (!baseCt)
         return;
 
-    CreatureTemplate const* diffCt = creature ? creature->GetCreatureTemplate() : baseCt;
+    CreatureTemplate const* diffCt = creature ? creature->GetCreatureTemplate() : baseCt;
+
+    // Use the difficulty template if it has spells; otherwise fall back to
+    // the base template (mirrors Scarbound domination spell-pool logic)
+    std::set<uint32> spellSet;
+    CreatureTemplate const* spellCt = diffCt;
+    bool hasTemplateSpells = false;
+    for (uint8 i = 0; i < MAX_CREATURE_SPELLS; ++i)
+    {
+        if (spellCt->spells[i] != 0)
+            hasTemplateSpells = true;
+    }
+    if (!hasTemplateSpells && baseCt != diffCt)
+        spellCt = baseCt;
+    for (uint8 i = 0; i < MAX_CREATURE_SPELLS; ++i)
+    {
+        if (spellCt->spells[i] != 0)
+            spellSet.insert(spellCt->spells[i]);
+    }
+
+    // Also gather combat spells from SmartAI scripts (base entry only),
+    // prebuilt at startup by the table cache
+    std::set<uint32> smartSpells;
+    if (!s_tableCache.GetSmartSpells(creatureEntry, smartSpells))
+    {
+        // action_type 11 = SMART_ACTION_CAST, 85 = SMART_ACTION_SELF_CAST
+        QueryResult result = WorldDatabase.Query(
+            "SELECT DISTINCT action_param1 FROM smart_scripts "
+            "WHERE entryorguid = {} AND source_type = 0 "
+            "AND action_type IN (11, 85) AND action_param1 != 0",
+            creatureEntry);
+        if (result)
+        {
+            do
+            {
+                smartSpells.insert((*result)[0].Get<uint32>());
+            } while (result->NextRow());
+        }
+    }
+    for (uint32 spellId : smartSpells)
+        if (sSpellMgr->GetSpellInfo(spellId))
+            spellSet.insert(spellId);
+
+    // Resolve to difficulty-appropriate spell IDs and fill slots
+    uint32 slot = 0;
+    for (uint32 spellId : spellSet)
+    {
+        if (slot >= MAX_GUARDIAN_SPELLS)
+            break;
+        uint32 resolved = creature ? sSpellMgr->GetSpellIdForDifficulty(spellId, creature) : spellId;
+        if (sSpellMgr->GetSpellInfo(resolved))
+            spells[slot++] = resolved;
+    }
+}
+
+// ============================================================================
+// Warm Relog Cache — slots saved at logout, reused by a quick re-login
+// ============================================================================
+
+// Keeps the slots written at logout for WarmCache.TtlSeconds so a relog can
+// hydrate from memory instead of reading character_guardian back. Any
+// guardian write for the owner after the logout save drops the entry, so a
+// relog then reads the DB. WarmCache.MaxKB bounds the entries' full size,
+// including the strings they own on the heap.
+class GuardianWarmCache
+{
+public:
+    void Put(uint32 owner, CapturedGuardianData const& data)
+    {
+        if (!config.warmCacheEnabled)
+            return;
+
+        std::lock_guard<std::mutex> lock(_lock);
+        Erase(owner);
+
+        uint64 now = GameTime::GetGameTimeMS().count();
+        Entry entry;
+        entry.owner     = owner;
+        entry.expiresMs = now + uint64(config.warmCacheTtlSeconds) * IN_MILLISECONDS;
+        for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
+            entry.slots[i] = data.slots[i];
+        entry.bytes = EntryBytes(entry);
+
+        _bytes += entry.bytes;
+        _lru.push_front(std::move(entry));
+        _index[owner] = _lru.begin();
+
+        // Every entry gets the same TTL, so expired ones collect at the back
+        while (!_lru.empty() && now >= _lru.back().expiresMs)
+            Erase(_lru.back().owner);
+
+        size_t maxBytes = size_t(config.warmCacheMaxKB) * 1024;
+        while (_lru.size() > 1 && _bytes > maxBytes)
+        {
+            Erase(_lru.back().owner);
+            metrics.warmEvictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Moves the owner's cached slots into `data` and drops the entry. Returns
+    // false (and drops it) if missing or expired.
+    bool Take(uint32 owner, CapturedGuardianData& data)
+    {
+        if (!config.warmCacheEnabled)
+            return false;
+
+        std::lock_guard<std::mutex> lock(_lock);
+        auto itr = _index.find(owner);
+        if (itr == _index.end())
+        {
+            metrics.warmMisses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        Entry& entry = *itr->second;
+        if (GameTime::GetGameTimeMS().count() >= entry.expiresMs)
+        {
+            metrics.warmMisses.fetch_add(1, std::memory_order_relaxed);
+            Erase(owner);
+            return false;
+        }
+
+        for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
+        {
+            GuardianSlotData& s = data.slots[i];
+            s = std::move(entry.slots[i]);
+            // Match a DB load: nothing spawned, no runtime snapshot
+            s.guardianGuid.Clear();
+            s.runtime.Clear();
+        }
+        Erase(owner);
+        metrics.warmHits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Called for every guardian write, from any thread. Drops the owner's
+    // entry: the cached slots no longer match what is in the DB.
+    void OnWrite(uint32 owner)
+    {
+        if (!config.warmCacheEnabled)
+            return;
+
+        std::lock_guard<std::mutex> lock(_lock);
+        if (_index.count(owner))
+        {
+            Erase(owner);
+            metrics.warmStale.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    size_t Size()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _lru.size();
+    }
+
+private:
+    struct Entry
+    {
+        uint32 owner     = 0;
+        uint64 expiresMs = 0;
+        size_t bytes     = 0;
+        GuardianSlotData slots[MAX_GUARDIAN_SLOTS];
+    };
+
+    // Heap block behind a string; 0 while it fits the small-string buffer
+    static size_t StringHeapBytes(std::string const& str)
+    {
+        char const* data = str.data();
+        char const* self = reinterpret_cast<char const*>(&str);
+        if (data >= self && data < self + sizeof(std::string))
+            return 0;
+        return str.capacity() + 1;
+    }
+
+    // List node, index node and the menu label strings the slots own
+    static size_t EntryBytes(Entry const& entry)
+    {
+        size_t bytes = sizeof(Entry) + 2 * sizeof(void*)
+            + sizeof(std::pair<uint32 const, std::list<Entry>::iterator>) + sizeof(void*);
+        for (GuardianSlotData const& s : entry.slots)
+        {
+            GuardianMenuLabels const& l = s.menuLabels;
+            for (std::string const* str : { &l.summon, &l.dismiss, &l.release, &l.stanceMelee, &l.stanceRanged })
+                bytes += StringHeapBytes(*str);
+            for (std::string const& str : l.archetypeSwitch)
+                bytes += StringHeapBytes(str);
+            for (std::string const& str : l.resourceSwitch)
+                bytes += StringHeapBytes(str);
+        }
+        return bytes;
+    }
+
+    void Erase(uint32 owner)
+    {
+        auto itr = _index.find(owner);
+        if (itr == _index.end())
+            return;
+        _bytes -= itr->second->bytes;
+        _lru.erase(itr->second);
+        _index.erase(itr);
+    }
+
+    std::mutex _lock;
+    std::list<Entry> _lru;                                       // front = most recent
+    std::unordered_map<uint32, std::list<Entry>::iterator> _index;
+    size_t _bytes = 0;
+};
+
+static GuardianWarmCache s_warmCache;
+
+// ============================================================================
+// Guardian Write Lane — guardian saves on their own connections
+// ============================================================================
+
+// Guardian saves run on a private pool of character DB connections, drained by
+// WriteLane.Workers low-priority threads, so a burst of leech/feed saves never
+// queues ahead of core character, mail or auction writes. Each (owner, slot)
+// holds at most one pending write; a newer save replaces it in place. Owners
+// are sharded across workers so one slot's writes always commit in order.
+// When the lane is full a save spills to the core queue, and that slot keeps
+// spilling until the core has committed it, so an older spilled write can
+// never land after a newer lane write.
+class GuardianWriteLane
+{
+public:
+    ~GuardianWriteLane() { Stop(); }
+
+    void Start()
+    {
+        if (_running || !config.writeLaneEnabled)
+            return;
+
+        std::string info = sConfigMgr->GetOption<std::string>("CharacterDatabaseInfo", "");
+        _pool.SetConnectionInfo(info, 0, static_cast<uint8>(config.writeLaneConnections));
+        if (info.empty() || _pool.Open() != 0)
+        {
+            LOG_ERROR("module", "mod-creature-capture: cannot open write lane connections, guardian saves use the character database queue");
+            return;
+        }
+
+        _maxPendingPerShard = std::max<size_t>(1, config.writeLaneMaxPending / config.writeLaneWorkers);
+        _running = true;
+        for (uint32 i = 0; i < config.writeLaneWorkers; ++i)
+        {
+            _shards.push_back(std::make_unique<Shard>());
+            _shards.back()->worker = std::thread(&GuardianWriteLane::WorkerLoop, this, _shards.back().get());
+        }
+
+        LOG_INFO("module", "mod-creature-capture: write lane running with {} worker(s), {} connection(s)",
+            config.writeLaneWorkers, config.writeLaneConnections);
+    }
+
+    // Drains everything still pending before closing the connections
+    void Stop()
+    {
+        if (!_running)
+            return;
+
+        for (auto& shard : _shards)
+        {
+            {
+                std::lock_guard<std::mutex> lock(shard->lock);
+                shard->stopping = true;
+            }
+            shard->wake.notify_all();
+        }
+        for (auto& shard : _shards)
+            if (shard->worker.joinable())
+                shard->worker.join();
+
+        _shards.clear();
+        _pool.Close();
+        _running = false;
+    }
+
+    // Takes `statements` and returns true, or returns false (lane off) and
+    // leaves them for the caller to write through CharacterDatabase.
+    bool Enqueue(uint32 owner, uint8 slot, std::vector<std::string>& statements)
+    {
+        if (!_running)
+            return false;
+
+        Shard& shard = ShardFor(owner);
+        uint64 key = MakeKey(owner, slot);
+        {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            auto spilled = shard.spilled.find(key);
+            if (spilled != shard.spilled.end())
+            {
+                metrics.laneOverflow.fetch_add(1, std::memory_order_relaxed);
+                ++spilled->second;
+                Spill(key, statements);
+                return true;
+            }
+
+            auto itr = shard.pending.find(key);
+            if (itr != shard.pending.end())
+            {
+                // Keep the original enqueue time so latency covers the whole wait
+                itr->second.statements = std::move(statements);
+                metrics.laneCoalesced.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // A slot already being written queues behind itself even when
+            // full; spilling it could let the core commit overtake it
+            if (shard.pending.size() >= _maxPendingPerShard &&
+                std::find(shard.inFlightKeys.begin(), shard.inFlightKeys.end(), key) == shard.inFlightKeys.end())
+            {
+                metrics.laneOverflow.fetch_add(1, std::memory_order_relaxed);
+                shard.spilled.emplace(key, 1);
+                Spill(key, statements);
+                return true;
+            }
+
+            shard.pending.emplace(key, PendingWrite{ std::move(statements), CaptureEventLog::NowMs() });
+            shard.order.push_back(key);
+        }
+        metrics.laneQueued.fetch_add(1, std::memory_order_relaxed);
+        metrics.laneDepth.fetch_add(1, std::memory_order_relaxed);
+        shard.wake.notify_one();
+        return true;
+    }
+
+    // True while a save for `owner` is pending, in flight or spilled and not
+    // yet committed.
+    bool HasPending(uint32 owner)
+    {
+        if (!_running)
+            return false;
+
+        Shard& shard = ShardFor(owner);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        return HasOwner(shard, owner);
+    }
+
+    // Moves the owner's writes to the front of the shard until they drain;
+    // used for a login waiting on them.
+    void Prioritize(uint32 owner)
+    {
+        if (!_running)
+            return;
+
+        Shard& shard = ShardFor(owner);
+        {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            if (!HasOwner(shard, owner))
+                return;
+            if (std::find(shard.urgentOwners.begin(), shard.urgentOwners.end(), owner) == shard.urgentOwners.end())
+                shard.urgentOwners.push_back(owner);
+        }
+        shard.wake.notify_one();
+    }
+
+    // World thread: completes spilled commits so their slots return to the lane.
+    void Update()
+    {
+        std::vector<uint64> committed;
+        {
+            std::lock_guard<std::mutex> lock(_spillLock);
+            _spillCallbacks.ProcessReadyCallbacks();
+            committed.swap(_spillsCommitted);
+        }
+
+        // Shard locks are taken outside _spillLock; Enqueue nests them the other way
+        for (uint64 key : committed)
+        {
+            Shard& shard = ShardFor(KeyOwner(key));
+            std::lock_guard<std::mutex> lock(shard.lock);
+            auto itr = shard.spilled.find(key);
+            if (itr != shard.spilled.end() && --itr->second == 0)
+                shard.spilled.erase(itr);
+        }
+    }
+
+private:
+    static constexpr size_t BATCH_SIZE = 32;
+    static constexpr int    WORKER_NICE = 10;
+
+    struct PendingWrite
+    {
+        std::vector<std::string> statements;
+        uint64 enqueuedMs = 0;
+    };
 
-    // Use the difficulty template if it has spells; otherwise fall back to
-    // the base template (mirrors Scarbound domination spell-pool logic)
-    std::set<uint32> spellSet;
-    CreatureTemplate const* spellCt = diffCt;
-    bool hasTemplateSpells = false;
-    for (uint8 i = 0; i < MAX_CREATURE_SPELLS; ++i)
+    struct Shard
     {
-        if (spellCt->spells[i] != 0)
-            hasTemplateSpells = true;
+        std::mutex lock;
+        std::condition_variable wake;
+        std::deque<uint64> order;                          // keys in first-enqueue order
+        std::unordered_map<uint64, PendingWrite> pending;
+        std::unordered_map<uint64, uint32> spilled;        // key -> core-queue commits outstanding
+        std::vector<uint64> inFlightKeys;
+        std::vector<uint32> urgentOwners;                  // logins waiting on their saves
+        bool stopping = false;
+        std::thread worker;
+    };
+
+    static uint64 MakeKey(uint32 owner, uint8 slot) { return (uint64(owner) << 8) | slot; }
+    static uint32 KeyOwner(uint64 key) { return uint32(key >> 8); }
+
+    Shard& ShardFor(uint32 owner) { return *_shards[owner % _shards.size()]; }
+
+    static bool HasOwner(Shard& shard, uint32 owner)
+    {
+        for (uint64 key : shard.inFlightKeys)
+            if (KeyOwner(key) == owner)
+                return true;
+        for (auto const& [key, write] : shard.pending)
+            if (KeyOwner(key) == owner)
+                return true;
+        for (auto const& [key, count] : shard.spilled)
+            if (KeyOwner(key) == owner)
+                return true;
+        return false;
     }
-    if (!hasTemplateSpells && baseCt != diffCt)
-        spellCt = baseCt;
-    for (uint8 i = 0; i < MAX_CREATURE_SPELLS; ++i)
+
+    static bool IsUrgent(Shard const& shard, uint64 key)
     {
-        if (spellCt->spells[i] != 0)
-            spellSet.insert(spellCt->spells[i]);
+        return std::find(shard.urgentOwners.begin(), shard.urgentOwners.end(), KeyOwner(key)) != shard.urgentOwners.end();
     }
 
-    // Also gather combat spells from SmartAI scripts (base entry only)
-    // action_type 11 = SMART_ACTION_CAST, 85 = SMART_ACTION_SELF_CAST
-    QueryResult result = WorldDatabase.Query(
-        "SELECT DISTINCT action_param1 FROM smart_scripts "
-        "WHERE entryorguid = {} AND source_type = 0 "
-        "AND action_type IN (11, 85) AND action_param1 != 0",
-        creatureEntry);
-    if (result)
+    // Caller holds the shard lock and has counted the spill in shard.spilled
+    void Spill(uint64 key, std::vector<std::string>& statements)
     {
-        do
-        {
-            uint32 spellId = (*result)[0].Get<uint32>();
-            if (sSpellMgr->GetSpellInfo(spellId))
-                spellSet.insert(spellId);
-        } while (result->NextRow());
+        auto trans = CharacterDatabase.BeginTransaction();
+        for (std::string const& sql : statements)
+            trans->Append(sql);
+
+        std::lock_guard<std::mutex> lock(_spillLock);
+        // Runs inside Update() with _spillLock held
+        _spillCallbacks.AddCallback(CharacterDatabase.AsyncCommitTransaction(trans)).AfterComplete(
+            [this, key](bool /*success*/) { _spillsCommitted.push_back(key); });
     }
 
-    // Resolve to difficulty-appropriate spell IDs and fill slots
-    uint32 slot = 0;
-    for (uint32 spellId : spellSet)
+    void WorkerLoop(Shard* shard)
     {
-        if (slot >= MAX_GUARDIAN_SPELLS)
-            break;
-        uint32 resolved = creature ? sSpellMgr->GetSpellIdForDifficulty(spellId, creature) : spellId;
-        if (sSpellMgr->GetSpellInfo(resolved))
-            spells[slot++] = resolved;
+#ifdef __linux__
+        // Lower this thread only; the rest of the server keeps its priority
+        setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), WORKER_NICE);
+#endif
+        std::vector<std::pair<uint64, PendingWrite>> batch;
+        batch.reserve(BATCH_SIZE);
+
+        for (;;)
+        {
+            bool stopping;
+            {
+                std::unique_lock<std::mutex> lock(shard->lock);
+                shard->wake.wait(lock, [shard] { return shard->stopping || !shard->order.empty(); });
+                stopping = shard->stopping;
+
+                // Owners waiting to log in go first
+                if (!shard->urgentOwners.empty())
+                    std::stable_partition(shard->order.begin(), shard->order.end(),
+                        [shard](uint64 key) { return IsUrgent(*shard, key); });
+
+                while (!shard->order.empty() && batch.size() < BATCH_SIZE)
+                {
+                    uint64 key = shard->order.front();
+                    shard->order.pop_front();
+                    auto node = shard->pending.extract(key);
+                    shard->inFlightKeys.push_back(key);
+                    batch.emplace_back(key, std::move(node.mapped()));
+                }
+            }
+
+            for (auto& [key, write] : batch)
+            {
+                auto trans = _pool.BeginTransaction();
+                for (std::string const& sql : write.statements)
+                    trans->Append(sql);
+                _pool.DirectCommitTransaction(trans);
+
+                uint64 latency = CaptureEventLog::NowMs() - write.enqueuedMs;
+                metrics.laneWritten.fetch_add(1, std::memory_order_relaxed);
+                metrics.laneLatencySumMs.fetch_add(latency, std::memory_order_relaxed);
+                uint64 prevMax = metrics.laneLatencyMaxMs.load(std::memory_order_relaxed);
+                while (latency > prevMax && !metrics.laneLatencyMaxMs.compare_exchange_weak(prevMax, latency, std::memory_order_relaxed)) {}
+            }
+
+            if (!batch.empty())
+            {
+                metrics.laneDepth.fetch_sub(batch.size(), std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> lock(shard->lock);
+                    shard->inFlightKeys.clear();
+                    std::erase_if(shard->urgentOwners, [shard](uint32 owner) { return !HasOwner(*shard, owner); });
+                }
+                batch.clear();
+            }
+
+            if (stopping)
+            {
+                std::lock_guard<std::mutex> lock(shard->lock);
+                if (shard->order.empty())
+                    break;
+            }
+        }
     }
+
+    DatabaseWorkerPool<CharacterDatabaseConnection> _pool;
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::mutex _spillLock;
+    AsyncCallbackProcessor<TransactionCallback> _spillCallbacks;
+    std::vector<uint64> _spillsCommitted;
+    size_t _maxPendingPerShard = 0;
+    bool _running = false;
+};
+
+static GuardianWriteLane s_writeLane;
+
+// Commit one slot's statements as a transaction, through the lane if it takes
+// them, otherwise through the core character database queue.
+static void CommitGuardianWrite(uint32 ownerGuid, uint8 slotIndex, std::vector<std::string> statements)
+{
+    s_warmCache.OnWrite(ownerGuid);
+
+    if (s_writeLane.Enqueue(ownerGuid, slotIndex, statements))
+        return;
+
+    auto trans = CharacterDatabase.BeginTransaction();
+    for (std::string const& sql : statements)
+        trans->Append(sql);
+    CharacterDatabase.CommitTransaction(trans);
 }
 
 // ============================================================================
@@ -2622,8 +5523,10 @@ static void PopulateDefaultSpells(uint32 creatureEntry, uint32* spells, Creature
 
 static void SaveGuardianSlotToDb(Player* player, GuardianSlotData* slotData, uint8 slotIndex)
 {
+    CC_PROFILE_ZONE("SaveGuardianSlotToDb");
     if (!slotData)
         return;
+    CC_PROFILE_ANNOTATE(slotData->guardianEntry, slotData->archetype);
     // Skip saving if empty AND nothing worth preserving
     if (slotData->guardianEntry == 0 && !slotData->HasPreservedProgress())
         return;
@@ -2631,9 +5534,9 @@ static void SaveGuardianSlotToDb(Player* player, GuardianSlotData* slotData, uin
     uint32 ownerGuid = player->GetGUID().GetCounter();
     std::string spellStr = SerializeSpells(slotData->spellSlots);
 
-    auto trans = CharacterDatabase.BeginTransaction();
-    trans->Append("DELETE FROM character_guardian WHERE owner = {} AND slot = {}", ownerGuid, slotIndex);
-    trans->Append(
+    std::vector<std::string> statements;
+    statements.push_back(Acore::StringFormat("DELETE FROM character_guardian WHERE owner = {} AND slot = {}", ownerGuid, slotIndex));
+    statements.push_back(Acore::StringFormat(
         "INSERT INTO character_guardian (owner, entry, level, slot, cur_health, cur_power, power_type, archetype, spells, display_id, equipment_id, power_chosen, ranged_dps, dismissed, "
         "bonus_strength, bonus_agility, bonus_intellect, bonus_stamina, bonus_attack_power, bonus_spell_power, "
         "bonus_crit_rating, bonus_dodge_rating, bonus_parry_rating, bonus_haste_rating, bonus_hit_rating, "
@@ -2677,14 +5580,18 @@ static void SaveGuardianSlotToDb(Player* player, GuardianSlotData* slotData, uin
         slotData->bonusResFrost,
         slotData->bonusResShadow,
         slotData->bonusResArcane
-    );
-    CharacterDatabase.CommitTransaction(trans);
+    ));
+    CommitGuardianWrite(ownerGuid, slotIndex, std::move(statements));
     slotData->savedToDb = true;
 }
 
 static void SaveAllGuardiansToDb(Player* player)
 {
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CC_PROFILE_ZONE("SaveAllGuardiansToDb");
+    CapturedGuardianData* data = FindGuardianData(player);
+    if (!data)
+        return;
+
     for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
     {
         if (data->slots[i].IsOccupied())
@@ -2692,103 +5599,601 @@ static void SaveAllGuardiansToDb(Player* player)
     }
 }
 
+// Columns read for each saved slot, starting with the slot index. The batched
+// login query prepends the owner column.
+static constexpr char const* GUARDIAN_LOAD_COLUMNS =
+    "slot, entry, level, cur_health, cur_power, power_type, archetype, spells, display_id, equipment_id, power_chosen, ranged_dps, dismissed, "
+    "bonus_strength, bonus_agility, bonus_intellect, bonus_stamina, bonus_attack_power, bonus_spell_power, "
+    "bonus_crit_rating, bonus_dodge_rating, bonus_parry_rating, bonus_haste_rating, bonus_hit_rating, "
+    "bonus_arpen_rating, bonus_expertise_rating, bonus_block_rating, bonus_block_value, bonus_armor, bonus_weapon_dmg, "
+    "bonus_res_holy, bonus_res_fire, bonus_res_nature, bonus_res_frost, bonus_res_shadow, bonus_res_arcane";
+
+// Fill one slot from a GUARDIAN_LOAD_COLUMNS row. Slots already occupied in
+// memory are left alone.
+static void ApplyGuardianRow(CapturedGuardianData* data, Field* fields)
+{
+    uint8 slot = fields[0].Get<uint8>();
+    if (slot >= MAX_GUARDIAN_SLOTS || data->slots[slot].IsOccupied())
+        return;
+
+    GuardianSlotData& s = data->slots[slot];
+    s.guardianEntry     = fields[1].Get<uint32>();
+    s.guardianLevel     = fields[2].Get<uint8>();
+    s.guardianHealth    = fields[3].Get<uint32>();
+    s.guardianPower     = fields[4].Get<uint32>();
+    s.guardianPowerType = fields[5].Get<uint8>();
+    s.archetype         = fields[6].Get<uint8>();
+    DeserializeSpells(fields[7].Get<std::string>(), s.spellSlots);
+    s.displayId         = fields[8].Get<uint32>();
+    s.equipmentId       = fields[9].Get<int8>();
+    s.powerChosen       = fields[10].Get<uint8>() != 0;
+    s.rangedDps         = fields[11].Get<uint8>() != 0;
+    s.dismissed         = fields[12].Get<uint8>() != 0;
+    s.bonusStrength     = fields[13].Get<int32>();
+    s.bonusAgility      = fields[14].Get<int32>();
+    s.bonusIntellect    = fields[15].Get<int32>();
+    s.bonusStamina      = fields[16].Get<int32>();
+    s.bonusAttackPower  = fields[17].Get<int32>();
+    s.bonusSpellPower   = fields[18].Get<int32>();
+    s.bonusCritRating   = fields[19].Get<int32>();
+    s.bonusDodgeRating  = fields[20].Get<int32>();
+    s.bonusParryRating  = fields[21].Get<int32>();
+    s.bonusHasteRating  = fields[22].Get<int32>();
+    s.bonusHitRating    = fields[23].Get<int32>();
+    s.bonusArmorPenRating  = fields[24].Get<int32>();
+    s.bonusExpertiseRating = fields[25].Get<int32>();
+    s.bonusBlockRating  = fields[26].Get<int32>();
+    s.bonusBlockValue   = fields[27].Get<int32>();
+    s.bonusArmor        = fields[28].Get<uint32>();
+    s.bonusWeaponDmg    = fields[29].Get<float>();
+    s.bonusResHoly      = fields[30].Get<int32>();
+    s.bonusResFire      = fields[31].Get<int32>();
+    s.bonusResNature    = fields[32].Get<int32>();
+    s.bonusResFrost     = fields[33].Get<int32>();
+    s.bonusResShadow    = fields[34].Get<int32>();
+    s.bonusResArcane    = fields[35].Get<int32>();
+    RefreshDerivedStats(s);
+    s.savedToDb         = true;
+}
+
 static void LoadGuardiansFromDb(Player* player)
 {
+    CC_PROFILE_ZONE("LoadGuardiansFromDb");
     uint32 ownerGuid = player->GetGUID().GetCounter();
 
     QueryResult result = CharacterDatabase.Query(
-        "SELECT slot, entry, level, cur_health, cur_power, power_type, archetype, spells, display_id, equipment_id, power_chosen, ranged_dps, dismissed, "
-        "bonus_strength, bonus_agility, bonus_intellect, bonus_stamina, bonus_attack_power, bonus_spell_power, "
-        "bonus_crit_rating, bonus_dodge_rating, bonus_parry_rating, bonus_haste_rating, bonus_hit_rating, "
-        "bonus_arpen_rating, bonus_expertise_rating, bonus_block_rating, bonus_block_value, bonus_armor, bonus_weapon_dmg, "
-        "bonus_res_holy, bonus_res_fire, bonus_res_nature, bonus_res_frost, bonus_res_shadow, bonus_res_arcane "
-        "FROM character_guardian WHERE owner = {}",
-        ownerGuid
-    );
+        "SELECT {} FROM character_guardian WHERE owner = {}", GUARDIAN_LOAD_COLUMNS, ownerGuid);
 
     if (!result)
         return;
 
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CapturedGuardianData* data = GetGuardianData(player);
 
     do
     {
-        Field* fields = result->Fetch();
-        uint8 slot = fields[0].Get<uint8>();
-        if (slot >= MAX_GUARDIAN_SLOTS)
+        ApplyGuardianRow(data, result->Fetch());
+    }
+    while (result->NextRow());
+}
+
+static void DeleteGuardianSlotFromDb(Player* player, uint8 slotIndex)
+{
+    uint32 ownerGuid = player->GetGUID().GetCounter();
+    CommitGuardianWrite(ownerGuid, slotIndex,
+        { Acore::StringFormat("DELETE FROM character_guardian WHERE owner = {} AND slot = {}", ownerGuid, slotIndex) });
+}
+
+// ============================================================================
+// Guardian Audit — bulk validation and repair of character_guardian
+// ============================================================================
+
+// `.capture audit report|repair` walks character_guardian by primary key,
+// Audit.BatchSize rows per page and at most one page per Audit.IntervalMs, on
+// its own thread so the reads never stall the world. Each page is handed to
+// the world thread, which checks the rows against ObjectMgr/SpellMgr (safe
+// there even across a .reload) and, in repair mode, rewrites bad rows through
+// the guardian write lane. Only one page is in flight at a time. Rows whose
+// owner is online are reported but not rewritten: the owner's next save
+// would overwrite the fix.
+enum GuardianAuditIssue : uint8
+{
+    AUDIT_ORPHAN_ENTRY   = 0,   // no creature_template for entry
+    AUDIT_BAD_SPELL      = 1,   // spell ID unknown to SpellMgr
+    AUDIT_BAD_LEVEL      = 2,   // 0 or above the player level cap
+    AUDIT_BAD_ARCHETYPE  = 3,
+    AUDIT_BAD_POWER_TYPE = 4,
+    AUDIT_BAD_BONUS      = 5,   // negative or above Audit.MaxBonus
+    AUDIT_BAD_SLOT       = 6,   // slot past MAX_GUARDIAN_SLOTS, never loaded
+    MAX_AUDIT_ISSUE
+};
+
+static constexpr char const* AUDIT_ISSUE_NAMES[MAX_AUDIT_ISSUE] =
+    { "orphan entry", "invalid spell", "impossible level", "invalid archetype", "invalid power type", "impossible bonus", "unreachable slot" };
+
+// Signed bonus columns, in GuardianAuditRow::bonus order
+static constexpr char const* AUDIT_BONUS_COLUMNS[] =
+{
+    "bonus_strength", "bonus_agility", "bonus_intellect", "bonus_stamina", "bonus_attack_power", "bonus_spell_power",
+    "bonus_crit_rating", "bonus_dodge_rating", "bonus_parry_rating", "bonus_haste_rating", "bonus_hit_rating",
+    "bonus_arpen_rating", "bonus_expertise_rating", "bonus_block_rating", "bonus_block_value",
+    "bonus_res_holy", "bonus_res_fire", "bonus_res_nature", "bonus_res_frost", "bonus_res_shadow", "bonus_res_arcane"
+};
+static constexpr uint32 AUDIT_BONUS_COUNT = sizeof(AUDIT_BONUS_COLUMNS) / sizeof(AUDIT_BONUS_COLUMNS[0]);
+
+struct GuardianAuditRow
+{
+    uint32 id        = 0;
+    uint32 owner     = 0;
+    uint8  slot      = 0;
+    uint32 entry     = 0;
+    uint8  level     = 0;
+    uint8  archetype = 0;
+    uint8  powerType = 0;
+    std::string spells;
+    int32  bonus[AUDIT_BONUS_COUNT] = {};
+    uint32 armor     = 0;
+    float  weaponDmg = 0.0f;
+};
+
+// Walks character_guardian in keyset pages read with AsyncQuery, one page in
+// flight at a time and Audit.IntervalMs between pages, so the scan never
+// holds a synchronous connection the world thread also uses. Each page is
+// checked on the world thread when its result arrives. The .capture audit
+// commands and Update() run in separate phases of the world tick.
+class GuardianAudit
+{
+public:
+    bool Running() const { return _running; }
+
+    bool Start(bool repair)
+    {
+        if (_running)
+            return false;
+
+        _running = true;
+        _querying = false;
+        _repair = repair;
+        _lastId = 0;
+        _nextPageMs = 0;
+        _scanned = 0;
+        _repaired = 0;
+        _skippedOnline = 0;
+        std::fill(std::begin(_issues), std::end(_issues), 0);
+        _startMs = CaptureEventLog::NowMs();
+        return true;
+    }
+
+    void Stop()
+    {
+        if (!_running)
+            return;
+        ++_generation;   // ignore the page still in flight, if any
+        _running = false;
+        _querying = false;
+        if (_scanned)
+            LogSummary("stopped");
+    }
+
+    void Update()
+    {
+        _callbacks.ProcessReadyCallbacks();
+
+        if (!_running || _querying || CaptureEventLog::NowMs() < _nextPageMs)
+            return;
+
+        _querying = true;
+        _callbacks.AddCallback(CharacterDatabase.AsyncQuery(Acore::StringFormat(
+            "SELECT {} FROM character_guardian WHERE id > {} ORDER BY id LIMIT {}", SelectColumns(), _lastId, config.auditBatchSize))
+            .WithCallback([this, generation = _generation, batchSize = config.auditBatchSize](QueryResult result)
+            {
+                if (generation == _generation)
+                    OnPage(result, batchSize);
+            }));
+    }
+
+    void Report(ChatHandler* handler) const
+    {
+        if (!_startMs)
+        {
+            handler->PSendSysMessage("No guardian audit has run since startup.");
+            return;
+        }
+
+        uint64 elapsedMs = CaptureEventLog::NowMs() - _startMs;
+        handler->PSendSysMessage("Guardian audit ({}): {}, {} rows in {} s ({} rows/s)",
+            _repair ? "repair" : "report", Running() ? "running" : "idle",
+            _scanned, elapsedMs / 1000, elapsedMs ? _scanned * 1000 / elapsedMs : 0);
+        for (uint8 i = 0; i < MAX_AUDIT_ISSUE; ++i)
+            if (_issues[i])
+                handler->PSendSysMessage("  {}: {}", AUDIT_ISSUE_NAMES[i], _issues[i]);
+        if (_repair)
+            handler->PSendSysMessage("  rows repaired: {}, skipped (owner online or saving): {}", _repaired, _skippedOnline);
+    }
+
+private:
+    static std::string const& SelectColumns()
+    {
+        static std::string const columns = []
+        {
+            std::string sql = "id, owner, slot, entry, level, archetype, power_type, spells";
+            for (char const* column : AUDIT_BONUS_COLUMNS)
+                sql += std::string(", ") + column;
+            return sql + ", bonus_armor, bonus_weapon_dmg";
+        }();
+        return columns;
+    }
+
+    // Keyset pages, so each page is an index range read no matter how deep
+    // into the table the scan is
+    void OnPage(QueryResult result, uint32 batchSize)
+    {
+        _querying = false;
+        uint32 rows = 0;
+        if (result)
+        {
+            uint8 maxLevel = uint8(std::min<uint32>(sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL), 255));
+            do
+            {
+                Field* fields = result->Fetch();
+                GuardianAuditRow row;
+                row.id        = fields[0].Get<uint32>();
+                row.owner     = fields[1].Get<uint32>();
+                row.slot      = fields[2].Get<uint8>();
+                row.entry     = fields[3].Get<uint32>();
+                row.level     = fields[4].Get<uint8>();
+                row.archetype = fields[5].Get<uint8>();
+                row.powerType = fields[6].Get<uint8>();
+                row.spells    = fields[7].Get<std::string>();
+                for (uint32 i = 0; i < AUDIT_BONUS_COUNT; ++i)
+                    row.bonus[i] = fields[8 + i].Get<int32>();
+                row.armor     = fields[8 + AUDIT_BONUS_COUNT].Get<uint32>();
+                row.weaponDmg = fields[9 + AUDIT_BONUS_COUNT].Get<float>();
+                _lastId = row.id;
+                ++rows;
+                Check(row, maxLevel);
+            }
+            while (result->NextRow());
+        }
+
+        if (rows < batchSize)
+        {
+            _running = false;
+            LogSummary("finished");
+            return;
+        }
+        _nextPageMs = CaptureEventLog::NowMs() + config.auditIntervalMs;
+    }
+
+    void Flag(GuardianAuditRow const& row, GuardianAuditIssue issue, std::string const& detail)
+    {
+        ++_issues[issue];
+        LOG_INFO("module", "mod-creature-capture: audit row {} (owner {}, slot {}): {} {}",
+            row.id, row.owner, uint32(row.slot), AUDIT_ISSUE_NAMES[issue], detail);
+    }
+
+    void Check(GuardianAuditRow& row, uint8 maxLevel)
+    {
+        ++_scanned;
+
+        std::vector<std::string> sets;
+        bool deleteRow = false;
+
+        if (row.slot >= MAX_GUARDIAN_SLOTS)
+        {
+            Flag(row, AUDIT_BAD_SLOT, "");
+            deleteRow = true;
+        }
+        else
+        {
+            if (row.entry && !sObjectMgr->GetCreatureTemplate(row.entry))
+            {
+                // Same as a progress-preserving release: the slot keeps its
+                // spells and bonuses for the next capture
+                Flag(row, AUDIT_ORPHAN_ENTRY, Acore::StringFormat("{}", row.entry));
+                sets.push_back("entry = 0, display_id = 0, equipment_id = 0, archetype = 0, "
+                    "power_chosen = 0, ranged_dps = 0, dismissed = 0");
+                row.entry = 0;
+                row.archetype = ARCHETYPE_DPS;
+            }
+
+            uint32 spells[MAX_GUARDIAN_SPELLS];
+            DeserializeSpells(row.spells, spells);
+            bool badSpell = false;
+            for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
+            {
+                if (spells[i] && !sSpellMgr->GetSpellInfo(spells[i]))
+                {
+                    Flag(row, AUDIT_BAD_SPELL, Acore::StringFormat("{}", spells[i]));
+                    spells[i] = 0;
+                    badSpell = true;
+                }
+            }
+            if (badSpell)
+                sets.push_back(Acore::StringFormat("spells = '{}'", SerializeSpells(spells)));
+
+            if (row.entry && (row.level == 0 || row.level > maxLevel))
+            {
+                Flag(row, AUDIT_BAD_LEVEL, Acore::StringFormat("{}", uint32(row.level)));
+                sets.push_back(Acore::StringFormat("level = {}", uint32(std::clamp<uint8>(row.level, 1, maxLevel))));
+            }
+
+            if (row.archetype > ARCHETYPE_HEALER)
+            {
+                Flag(row, AUDIT_BAD_ARCHETYPE, Acore::StringFormat("{}", uint32(row.archetype)));
+                sets.push_back("archetype = 0");
+            }
+
+            // character_guardian.power_type: 0=mana, 1=rage, 2=focus, 3=energy
+            if (row.powerType > POWER_ENERGY)
+            {
+                Flag(row, AUDIT_BAD_POWER_TYPE, Acore::StringFormat("{}", uint32(row.powerType)));
+                sets.push_back("power_type = 0, cur_power = 0");
+            }
+
+            int64 maxBonus = config.auditMaxBonus;
+            for (uint32 i = 0; i < AUDIT_BONUS_COUNT; ++i)
+            {
+                if (row.bonus[i] < 0 || row.bonus[i] > maxBonus)
+                {
+                    Flag(row, AUDIT_BAD_BONUS, Acore::StringFormat("{} = {}", AUDIT_BONUS_COLUMNS[i], row.bonus[i]));
+                    sets.push_back(Acore::StringFormat("{} = {}", AUDIT_BONUS_COLUMNS[i], std::clamp<int64>(row.bonus[i], 0, maxBonus)));
+                }
+            }
+            if (row.armor > maxBonus)
+            {
+                Flag(row, AUDIT_BAD_BONUS, Acore::StringFormat("bonus_armor = {}", row.armor));
+                sets.push_back(Acore::StringFormat("bonus_armor = {}", maxBonus));
+            }
+            if (!(row.weaponDmg >= 0.0f && row.weaponDmg <= float(maxBonus)))
+            {
+                Flag(row, AUDIT_BAD_BONUS, Acore::StringFormat("bonus_weapon_dmg = {}", row.weaponDmg));
+                sets.push_back("bonus_weapon_dmg = 0");
+            }
+        }
+
+        if (!_repair || (sets.empty() && !deleteRow))
+            return;
+
+        // An online owner will save over the row, and an owner whose logout
+        // save is still in the write lane has a newer row on its way; the
+        // next audit sees what they wrote
+        if (ObjectAccessor::FindPlayerByLowGUID(row.owner) || s_writeLane.HasPending(row.owner))
+        {
+            ++_skippedOnline;
+            return;
+        }
+
+        std::string sql;
+        if (deleteRow)
+            sql = Acore::StringFormat("DELETE FROM character_guardian WHERE id = {}", row.id);
+        else
+        {
+            sql = "UPDATE character_guardian SET ";
+            for (size_t i = 0; i < sets.size(); ++i)
+                sql += (i ? ", " : "") + sets[i];
+            sql += Acore::StringFormat(" WHERE id = {}", row.id);
+        }
+
+        // Straight to the core queue: going through the lane would coalesce
+        // with, and could replace, a save for the same slot
+        s_warmCache.OnWrite(row.owner);
+        CharacterDatabase.Execute(sql);
+        ++_repaired;
+    }
+
+    void LogSummary(char const* how) const
+    {
+        std::string issues;
+        for (uint8 i = 0; i < MAX_AUDIT_ISSUE; ++i)
+            if (_issues[i])
+                issues += Acore::StringFormat("{}{} {}", issues.empty() ? "" : ", ", _issues[i], AUDIT_ISSUE_NAMES[i]);
+        LOG_INFO("module", "mod-creature-capture: guardian audit {} after {} rows in {} ms: {}; {} repaired, {} skipped (owner online or saving)",
+            how, _scanned, CaptureEventLog::NowMs() - _startMs, issues.empty() ? "no issues" : issues,
+            _repaired, _skippedOnline);
+    }
+
+    QueryCallbackProcessor _callbacks;
+    uint32 _generation = 0;
+    bool   _running = false;
+    bool   _querying = false;
+    uint32 _lastId = 0;
+    uint64 _nextPageMs = 0;
+
+    bool   _repair = false;
+    uint64 _startMs = 0;
+    uint64 _scanned = 0;
+    uint64 _repaired = 0;
+    uint64 _skippedOnline = 0;
+    uint64 _issues[MAX_AUDIT_ISSUE] = {};
+};
+
+static GuardianAudit s_audit;
+
+// ============================================================================
+// Dismiss / Snapshot Helpers
+// ============================================================================
+
+static void SnapshotGuardianSlot(Player* player, uint8 slotIndex)
+{
+    CapturedGuardianData* data = GetGuardianData(player);
+    GuardianSlotData& s = data->slots[slotIndex];
+
+    if (!s.IsActive())
+        return;
+
+    Creature* guardian = ObjectAccessor::GetCreature(*player, s.guardianGuid);
+    if (!guardian)
+        return;
+
+    s.guardianEntry     = guardian->GetEntry();
+    s.guardianLevel     = guardian->GetLevel();
+    s.guardianHealth    = guardian->GetHealth();
+    s.guardianPowerType = guardian->getPowerType();
+    s.guardianPower     = guardian->GetPower(Powers(s.guardianPowerType));
+
+    if (CapturedGuardianAI* ai = dynamic_cast<CapturedGuardianAI*>(guardian->AI()))
+    {
+        memcpy(s.spellSlots, ai->GetSpells(), sizeof(s.spellSlots));
+        if (guardian->IsAlive())
+            ai->SaveRuntimeState(s.runtime);
+    }
+}
+
+// Push a slot's derived HP/mana and the HealthPct/DamagePct scaling onto a
+// creature through the stat modifier system, so UpdateMaxHealth and percentage
+// auras (e.g. SPELL_AURA_MOD_INCREASE_HEALTH_PERCENT) recalculate correctly.
+// refill: top up to the new maximum (summon); otherwise keep the current %.
+static void ApplyDerivedStats(Creature* guardian, GuardianDerivedStats const& d, bool refill)
+{
+    float healthRatio = refill ? 1.0f : guardian->GetHealthPct() / 100.0f;
+    guardian->SetStatPctModifier(UNIT_MOD_HEALTH, BASE_PCT, config.healthPct / 100.0f);
+    guardian->SetStatFlatModifier(UNIT_MOD_HEALTH, TOTAL_VALUE, static_cast<float>(d.health));
+    guardian->UpdateMaxHealth();
+    if (guardian->IsAlive())
+        guardian->SetHealth(std::max<uint32>(1, uint32(guardian->GetMaxHealth() * healthRatio)));
+
+    if (guardian->getPowerType() == POWER_MANA)
+    {
+        uint32 oldMax    = guardian->GetMaxPower(POWER_MANA);
+        float manaRatio  = (refill || !oldMax) ? 1.0f : float(guardian->GetPower(POWER_MANA)) / float(oldMax);
+        guardian->SetStatFlatModifier(UNIT_MOD_MANA, TOTAL_VALUE, static_cast<float>(d.mana));
+        guardian->UpdateMaxPower(POWER_MANA);
+        guardian->SetPower(POWER_MANA, uint32(guardian->GetMaxPower(POWER_MANA) * manaRatio));
+    }
+
+    guardian->SetStatPctModifier(UNIT_MOD_DAMAGE_MAINHAND, BASE_PCT, config.damagePct / 100.0f);
+    guardian->SetStatPctModifier(UNIT_MOD_DAMAGE_RANGED, BASE_PCT, config.damagePct / 100.0f);
+    guardian->UpdateDamagePhysical(BASE_ATTACK);
+    guardian->UpdateDamagePhysical(RANGED_ATTACK);
+}
+
+// Derived stats come only from the slot's bonuses, so a config reload leaves
+// them as they are; what it can change is the HealthPct/DamagePct scaling
+// ApplyDerivedStats puts on live guardians. Runs on the world thread.
+static void ReapplyGuardianConfigScaling()
+{
+    uint32 applied = 0;
+    std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
+    for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
+    {
+        if (!player || !player->IsInWorld())
+            continue;
+        CapturedGuardianData* data = FindGuardianData(player);
+        if (!data)
             continue;
 
-        GuardianSlotData& s = data->slots[slot];
-        s.guardianEntry     = fields[1].Get<uint32>();
-        s.guardianLevel     = fields[2].Get<uint8>();
-        s.guardianHealth    = fields[3].Get<uint32>();
-        s.guardianPower     = fields[4].Get<uint32>();
-        s.guardianPowerType = fields[5].Get<uint8>();
-        s.archetype         = fields[6].Get<uint8>();
-        DeserializeSpells(fields[7].Get<std::string>(), s.spellSlots);
-        s.displayId         = fields[8].Get<uint32>();
-        s.equipmentId       = fields[9].Get<int8>();
-        s.powerChosen       = fields[10].Get<uint8>() != 0;
-        s.rangedDps         = fields[11].Get<uint8>() != 0;
-        s.dismissed         = fields[12].Get<uint8>() != 0;
-        s.bonusStrength     = fields[13].Get<int32>();
-        s.bonusAgility      = fields[14].Get<int32>();
-        s.bonusIntellect    = fields[15].Get<int32>();
-        s.bonusStamina      = fields[16].Get<int32>();
-        s.bonusAttackPower  = fields[17].Get<int32>();
-        s.bonusSpellPower   = fields[18].Get<int32>();
-        s.bonusCritRating   = fields[19].Get<int32>();
-        s.bonusDodgeRating  = fields[20].Get<int32>();
-        s.bonusParryRating  = fields[21].Get<int32>();
-        s.bonusHasteRating  = fields[22].Get<int32>();
-        s.bonusHitRating    = fields[23].Get<int32>();
-        s.bonusArmorPenRating  = fields[24].Get<int32>();
-        s.bonusExpertiseRating = fields[25].Get<int32>();
-        s.bonusBlockRating  = fields[26].Get<int32>();
-        s.bonusBlockValue   = fields[27].Get<int32>();
-        s.bonusArmor        = fields[28].Get<uint32>();
-        s.bonusWeaponDmg    = fields[29].Get<float>();
-        s.bonusResHoly      = fields[30].Get<int32>();
-        s.bonusResFire      = fields[31].Get<int32>();
-        s.bonusResNature    = fields[32].Get<int32>();
-        s.bonusResFrost     = fields[33].Get<int32>();
-        s.bonusResShadow    = fields[34].Get<int32>();
-        s.bonusResArcane    = fields[35].Get<int32>();
-        s.savedToDb         = true;
+        for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
+        {
+            GuardianSlotData& s = data->slots[i];
+            if (!s.IsActive())
+                continue;
+            if (Creature* guardian = ObjectAccessor::GetCreature(*player, s.guardianGuid))
+            {
+                ApplyDerivedStats(guardian, s.derived, false);
+                ++applied;
+            }
+        }
+    }
+
+    LOG_INFO("module", "mod-creature-capture: re-applied config scaling to {} live guardians", applied);
+}
+
+// ============================================================================
+// Zone Rules
+// ============================================================================
+
+// Per-map and per-zone rules from world.creature_capture_rules, flattened into
+// dense arrays indexed by map ID and zone ID so the capture and summon paths
+// pay two array loads per check. A zone row overrides its map's row; places
+// without a row allow capture and every slot.
+struct GuardianZoneRule
+{
+    uint8 present      = 0;
+    uint8 allowCapture = 1;
+    uint8 maxGuardians = MAX_GUARDIAN_SLOTS;
+};
+
+class GuardianZoneRules
+{
+public:
+    GuardianZoneRule const& Get(uint32 mapId, uint32 zoneId) const
+    {
+        RuleSet const* rules = _current.load(std::memory_order_acquire);
+        if (zoneId < rules->zones.size() && rules->zones[zoneId].present)
+            return rules->zones[zoneId];
+        if (mapId < rules->maps.size() && rules->maps[mapId].present)
+            return rules->maps[mapId];
+        return DEFAULT_RULE;
+    }
+
+    GuardianZoneRule const& For(Player* player) const
+    {
+        return Get(player->GetMapId(), player->GetZoneId());
     }
-    while (result->NextRow());
-}
 
-static void DeleteGuardianSlotFromDb(Player* player, uint8 slotIndex)
-{
-    uint32 ownerGuid = player->GetGUID().GetCounter();
-    CharacterDatabase.Execute("DELETE FROM character_guardian WHERE owner = {} AND slot = {}", ownerGuid, slotIndex);
-}
+    // Builds a new rule set and publishes it with one pointer store. Runs on
+    // the world thread (startup, or a command between map updates); the set
+    // it replaces is kept until the next reload so no reader can see it freed.
+    uint32 Load()
+    {
+        auto rules = std::make_unique<RuleSet>();
+        uint32 count = 0;
 
-// ============================================================================
-// Dismiss / Snapshot Helpers
-// ============================================================================
+        QueryResult result = WorldDatabase.Query(
+            "SELECT map_id, zone_id, allow_capture, max_guardians FROM creature_capture_rules");
+        if (result)
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+                uint32 mapId  = fields[0].Get<uint16>();
+                uint32 zoneId = fields[1].Get<uint16>();
+
+                GuardianZoneRule rule;
+                rule.present      = 1;
+                rule.allowCapture = fields[2].Get<uint8>() ? 1 : 0;
+                rule.maxGuardians = std::min<uint8>(fields[3].Get<uint8>(), MAX_GUARDIAN_SLOTS);
+
+                std::vector<GuardianZoneRule>& table = zoneId ? rules->zones : rules->maps;
+                uint32 index = zoneId ? zoneId : mapId;
+                if (index >= table.size())
+                    table.resize(index + 1);
+                table[index] = rule;
+                ++count;
+            }
+            while (result->NextRow());
+        }
 
-static void SnapshotGuardianSlot(Player* player, uint8 slotIndex)
-{
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-    GuardianSlotData& s = data->slots[slotIndex];
+        _retired = std::move(_owned);
+        _owned = std::move(rules);
+        _current.store(_owned.get(), std::memory_order_release);
+        return count;
+    }
 
-    if (!s.IsActive())
-        return;
+private:
+    struct RuleSet
+    {
+        std::vector<GuardianZoneRule> maps;
+        std::vector<GuardianZoneRule> zones;
+    };
 
-    Creature* guardian = ObjectAccessor::GetCreature(*player, s.guardianGuid);
-    if (!guardian)
-        return;
+    static inline GuardianZoneRule const DEFAULT_RULE{};
+    static inline RuleSet const EMPTY_RULES{};
 
-    s.guardianEntry     = guardian->GetEntry();
-    s.guardianLevel     = guardian->GetLevel();
-    s.guardianHealth    = guardian->GetHealth();
-    s.guardianPowerType = guardian->getPowerType();
-    s.guardianPower     = guardian->GetPower(Powers(s.guardianPowerType));
+    std::atomic<RuleSet const*> _current{ &EMPTY_RULES };
+    std::unique_ptr<RuleSet> _owned;
+    std::unique_ptr<RuleSet> _retired;
+};
 
-    if (CapturedGuardianAI* ai = dynamic_cast<CapturedGuardianAI*>(guardian->AI()))
-        memcpy(s.spellSlots, ai->GetSpells(), sizeof(s.spellSlots));
+static GuardianZoneRules s_zoneRules;
+
+static uint8 CountActiveGuardians(CapturedGuardianData const* data)
+{
+    uint8 active = 0;
+    for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
+        if (data->slots[i].IsActive())
+            ++active;
+    return active;
 }
 
 // Forward declaration (defined below after helper functions)
@@ -2799,13 +6204,23 @@ static TempSummon* SummonCapturedGuardian(Player* player, uint32 entry, uint8 le
 // Returns the summoned creature, or nullptr on failure.
 static TempSummon* SummonGuardianSlot(Player* player, uint8 slotIndex, bool save = true)
 {
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CapturedGuardianData* data = GetGuardianData(player);
     GuardianSlotData& s = data->slots[slotIndex];
 
     if (!s.IsOccupied() || s.IsActive())
         return nullptr;
 
+    if (CountActiveGuardians(data) >= s_zoneRules.For(player).maxGuardians)
+        return nullptr;
+
+    // A stored guardian catches up with levels its owner gained meanwhile
+    uint8 oldLevel = s.guardianLevel;
     s.guardianLevel = player->GetLevel();
+    if (s.guardianLevel != oldLevel)
+    {
+        LogCaptureEvent(CAPTURE_EVENT_LEVEL, player, slotIndex, s, oldLevel);
+        NotifyGuardianLevelChanged(player, slotIndex, s, oldLevel);
+    }
 
     TempSummon* guardian = SummonCapturedGuardian(player, s.guardianEntry, s.guardianLevel,
         s.archetype, s.spellSlots, slotIndex, s.displayId, s.equipmentId, s.guardianPowerType, s.powerChosen, s.rangedDps);
@@ -2817,12 +6232,17 @@ static TempSummon* SummonGuardianSlot(Player* player, uint8 slotIndex, bool save
     if (s.powerChosen && s.guardianPower > 0)
         guardian->SetPower(Powers(s.guardianPowerType), s.guardianPower);
 
+    if (CapturedGuardianAI* ai = dynamic_cast<CapturedGuardianAI*>(guardian->AI()))
+        ai->RestoreRuntimeState(s.runtime);
+    s.runtime.Clear();
+
     s.guardianGuid = guardian->GetGUID();
     s.dismissed = false;
 
     if (save)
         SaveGuardianSlotToDb(player, &s, slotIndex);
 
+    ++s.version;
     SendFullSlotState(player, slotIndex, s);
 
     return guardian;
@@ -2832,7 +6252,7 @@ static TempSummon* SummonGuardianSlot(Player* player, uint8 slotIndex, bool save
 // If save=false, caller is responsible for saving (e.g. bulk save on logout).
 static void DismissGuardianSlot(Player* player, uint8 slotIndex, bool save = true)
 {
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CapturedGuardianData* data = GetGuardianData(player);
     GuardianSlotData& s = data->slots[slotIndex];
 
     if (!s.IsActive())
@@ -2850,6 +6270,7 @@ static void DismissGuardianSlot(Player* player, uint8 slotIndex, bool save = tru
         SaveGuardianSlotToDb(player, &s, slotIndex);
 
     SendGuardianDismiss(player, slotIndex);
+    BumpSlotVersion(player, slotIndex);
 }
 
 static void DismissAllGuardians(Player* player, bool save = true)
@@ -2870,6 +6291,12 @@ static bool CanCaptureCreature(Player* player, Creature* target, std::string& er
         return false;
     }
 
+    if (!s_zoneRules.For(player).allowCapture)
+    {
+        error = "Creatures cannot be captured here.";
+        return false;
+    }
+
     if (!target->IsAlive())
     {
         error = "Target must be alive.";
@@ -2968,6 +6395,9 @@ static bool CanCaptureCreature(Player* player, Creature* target, std::string& er
 static TempSummon* SummonCapturedGuardian(Player* player, uint32 entry, uint8 level, uint8 archetype,
     uint32* spells, uint8 slotIndex, uint32 displayId, int8 equipmentId, uint8 powerType, bool powerChosen, bool rangedDps)
 {
+    CC_PROFILE_ZONE("SummonCapturedGuardian");
+    CC_PROFILE_ANNOTATE(entry, archetype);
+
     float angle = GUARDIAN_FOLLOW_ANGLES[slotIndex % MAX_GUARDIAN_SLOTS];
 
     float x, y, z;
@@ -3008,13 +6438,6 @@ static TempSummon* SummonCapturedGuardian(Player* player, uint32 entry, uint8 le
     guardian->SetFlag(UNIT_NPC_FLAGS, UNIT_NPC_FLAG_GOSSIP);
     guardian->SetReactState(REACT_DEFENSIVE);
 
-    if (config.healthPct != 100)
-    {
-        uint32 newHealth = guardian->GetMaxHealth() * config.healthPct / 100;
-        guardian->SetMaxHealth(newHealth);
-        guardian->SetHealth(newHealth);
-    }
-
     if (powerChosen)
     {
         Powers pType = Powers(powerType);
@@ -3044,29 +6467,13 @@ static TempSummon* SummonCapturedGuardian(Player* player, uint32 entry, uint8 le
         guardian->LoadEquipment(equipmentId, true);
 
     // Apply on-summon bonus stats (damage/crit/dodge/parry are handled by UnitScript hooks)
-    CapturedGuardianData* bonusData = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CapturedGuardianData* bonusData = GetGuardianData(player);
     if (slotIndex < MAX_GUARDIAN_SLOTS)
     {
         GuardianSlotData& slot = bonusData->slots[slotIndex];
 
-        // HP from STA — register via modifier system so percentage auras
-        // (e.g. SPELL_AURA_MOD_INCREASE_HEALTH_PERCENT) recalculate correctly
-        uint32 bonusHP = GetBonusHealth(slot);
-        if (bonusHP > 0)
-        {
-            guardian->SetStatFlatModifier(UNIT_MOD_HEALTH, TOTAL_VALUE, static_cast<float>(bonusHP));
-            guardian->UpdateMaxHealth();
-            guardian->SetHealth(guardian->GetMaxHealth());
-        }
-
-        // Mana from INT — same reasoning
-        uint32 bonusMana = GetBonusMana(slot);
-        if (bonusMana > 0 && guardian->getPowerType() == POWER_MANA)
-        {
-            guardian->SetStatFlatModifier(UNIT_MOD_MANA, TOTAL_VALUE, static_cast<float>(bonusMana));
-            guardian->UpdateMaxPower(POWER_MANA);
-            guardian->SetPower(POWER_MANA, guardian->GetMaxPower(POWER_MANA));
-        }
+        // HP from STA, mana from INT, HealthPct/DamagePct scaling
+        ApplyDerivedStats(guardian, slot.derived, true);
 
         // Armor
         if (slot.bonusArmor > 0)
@@ -3116,8 +6523,10 @@ static TempSummon* SummonCapturedGuardian(Player* player, uint32 entry, uint8 le
     guardian->GetMotionMaster()->Clear();
     guardian->GetMotionMaster()->MoveFollow(player, GUARDIAN_FOLLOW_DIST, angle);
 
-    // Install archetype-driven AI
-    guardian->SetAI(new CapturedGuardianAI(guardian, archetype, spells, slotIndex, rangedDps));
+    // Install archetype-driven AI, reusing the slot's precompiled spell plan
+    GuardianSpellPlan const* plan = slotIndex < MAX_GUARDIAN_SLOTS ?
+        &GetSlotSpellPlan(bonusData->slots[slotIndex]) : nullptr;
+    guardian->SetAI(new CapturedGuardianAI(guardian, archetype, spells, slotIndex, rangedDps, plan));
 
     return guardian;
 }
@@ -3218,6 +6627,7 @@ static void ExtractEquipSpellBonuses(ItemTemplate const* item, GuardianSlotData&
 
 static void ExtractItemBonuses(ItemTemplate const* item, GuardianSlotData& s)
 {
+    CC_PROFILE_ZONE("ExtractItemBonuses(ItemTemplate)");
     // Armor at 50%
     s.bonusArmor += item->Armor / 2;
 
@@ -3469,6 +6879,7 @@ static void ExtractRandomEnchantBonuses(Item const* item,
 // (includes base template stats + random suffix/property stats)
 static void ExtractItemBonuses(Item const* item, GuardianSlotData& s)
 {
+    CC_PROFILE_ZONE("ExtractItemBonuses(Item)");
     if (!item)
         return;
     ExtractItemBonuses(item->GetTemplate(), s);
@@ -3481,6 +6892,9 @@ static void ExtractItemBonuses(Item const* item, GuardianSlotData& s)
 
 static int8 FindTargetedGuardianSlot(Player* player, CapturedGuardianData* data)
 {
+    if (!data)
+        return -1;
+
     Unit* selected = player->GetSelectedUnit();
     if (!selected || !selected->IsCreature())
         return -1;
@@ -3494,6 +6908,18 @@ static int8 FindTargetedGuardianSlot(Player* player, CapturedGuardianData* data)
 
 static void DoCapture(Player* player, Creature* target, uint8 slotIndex)
 {
+    // The slot was empty when the channel started, but a login load or
+    // another summon may have filled it during the 10 seconds
+    CapturedGuardianData* data = GetGuardianData(player);
+    GuardianSlotData& s = data->slots[slotIndex];
+    if (s.IsOccupied())
+    {
+        target->AI()->EnterEvadeMode();
+        ChatHandler(player->GetSession()).PSendSysMessage(
+            "|cffff0000[Capture]|r Capture failed: that guardian slot is no longer free.");
+        return;
+    }
+
     uint32 entry               = target->GetEntry();
     uint8  level               = player->GetLevel();
     std::string name           = target->GetName();
@@ -3501,8 +6927,6 @@ static void DoCapture(Player* player, Creature* target, uint8 slotIndex)
     int8   capturedEquipmentId = static_cast<int8>(target->GetCurrentEquipmentId());
     uint8  capturedPowerType   = target->getPowerType();
 
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-    GuardianSlotData& s = data->slots[slotIndex];
     uint32 spells[MAX_GUARDIAN_SPELLS];
     if (s.HasPreservedProgress())
         memcpy(spells, s.spellSlots, sizeof(spells));
@@ -3532,8 +6956,11 @@ static void DoCapture(Player* player, Creature* target, uint8 slotIndex)
         memcpy(s.spellSlots, spells, sizeof(spells));
 
     SaveGuardianSlotToDb(player, &s, slotIndex);
+    LogCaptureEvent(CAPTURE_EVENT_CAPTURE, player, slotIndex, s);
+    NotifyGuardianCaptured(player, slotIndex, s);
     ChatHandler(player->GetSession()).PSendSysMessage(
         "|cff00ff00[Capture]|r {} captured in slot {}!", name, slotIndex + 1);
+    ++s.version;
     SendFullSlotState(player, slotIndex, s);
 }
 
@@ -3544,7 +6971,7 @@ static void DoCapture(Player* player, Creature* target, uint8 slotIndex)
 static bool StartCaptureChannel(Player* player, Creature* target, uint8 slotIndex,
     std::function<void(std::string const&)> sendMsg)
 {
-    CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CapturedGuardianData* data = GetGuardianData(player);
     data->pendingCaptureTarget = target->GetGUID();
     data->pendingCaptureSlot   = slotIndex;
 
@@ -3566,6 +6993,112 @@ static bool StartCaptureChannel(Player* player, Creature* target, uint8 slotInde
     return true;
 }
 
+// ============================================================================
+// Feed Preview — deferred, coalesced reply for .capture feedpreview
+// ============================================================================
+
+// The item the preview is for, or nullptr (with the reason sent to the player)
+// if it is no longer in the bags or its level requirement is too high for the
+// guardian. Checked on every request, cache hits included.
+static Item* FindFeedPreviewItem(Player* player, ItemTemplate const* proto, GuardianSlotData const& s)
+{
+    ChatHandler handler(player->GetSession());
+
+    Item* item = player->GetItemByEntry(proto->ItemId);
+    if (!item)
+    {
+        handler.PSendSysMessage("|cffff0000[Guardian]|r You don't have that item.");
+        return nullptr;
+    }
+
+    if (proto->RequiredLevel > 0 &&
+        static_cast<int32>(proto->RequiredLevel) > static_cast<int32>(s.guardianLevel) + 15)
+    {
+        handler.PSendSysMessage("|cffff0000[Guardian]|r Item level requirement too high for this guardian.");
+        return nullptr;
+    }
+
+    return item;
+}
+
+// Serve the player's pending preview request: inventory lookup, bonus
+// extraction and the FEEDPREVIEW reply, which is also cached for repeats.
+static void ServeFeedPreview(Player* player, CapturedGuardianData* data)
+{
+    FeedPreviewState& fp = data->feedPreview;
+    uint32 itemEntry = fp.pendingItem;
+    uint8  guardianSlot = fp.pendingSlot;
+    fp.pendingItem = 0;
+
+    GuardianSlotData& s = data->slots[guardianSlot];
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemEntry);
+    if (!itemEntry || !proto || !s.IsOccupied())
+        return;
+
+    Item* item = FindFeedPreviewItem(player, proto, s);
+    if (!item)
+        return;
+
+    // Compute preview by extracting into a temporary slot copy
+    GuardianSlotData preview;
+    ExtractItemBonuses(item, preview);
+
+    std::string payload = EncodeFeedPreview(guardianSlot, itemEntry, preview);
+    SendCaptureAddonMessage(player, payload);
+    metrics.feedPreviewServed.fetch_add(1, std::memory_order_relaxed);
+
+    if (config.feedPreviewCacheMs)
+        fp.Store(guardianSlot, itemEntry, item->GetItemRandomPropertyId(),
+            GameTime::GetGameTimeMS().count() + config.feedPreviewCacheMs, std::move(payload));
+}
+
+// Shared spell checks for .capture teach and .capture loadout.
+static bool CanGuardianLearnSpell(SpellInfo const* spellInfo, GuardianSlotData const& s, Creature const* guardian, std::string& error)
+{
+    if (!spellInfo)
+    {
+        error = "Spell does not exist.";
+        return false;
+    }
+
+    // Require a resource type to be chosen before teaching spells with a power cost
+    bool hasPowerCost = spellInfo->PowerType != POWER_HEALTH &&
+        (spellInfo->ManaCost > 0 || spellInfo->ManaCostPercentage > 0);
+    if (hasPowerCost && !s.powerChosen)
+    {
+        error = "Choose a resource type for this guardian before teaching spells that cost resources.";
+        return false;
+    }
+
+    // Check power type compatibility
+    if (spellInfo->PowerType != POWER_HEALTH &&
+        spellInfo->ManaCost > 0 &&
+        static_cast<uint8>(spellInfo->PowerType) != guardian->getPowerType())
+    {
+        std::string powerName;
+        switch (spellInfo->PowerType)
+        {
+            case POWER_MANA:   powerName = "Mana"; break;
+            case POWER_RAGE:   powerName = "Rage"; break;
+            case POWER_ENERGY: powerName = "Energy"; break;
+            case POWER_FOCUS:  powerName = "Focus"; break;
+            default:           powerName = "an unknown resource"; break;
+        }
+        error = fmt::format("This guardian cannot use {} spells.", powerName);
+        return false;
+    }
+
+    if (spellInfo->PowerType != POWER_HEALTH &&
+        spellInfo->ManaCostPercentage > 0 &&
+        static_cast<uint8>(spellInfo->PowerType) != guardian->getPowerType())
+    {
+        error = "This guardian lacks the required resource for this spell.";
+        return false;
+    }
+
+    return true;
+}
+
 // ============================================================================
 // Command Script
 // ============================================================================
@@ -3579,6 +7112,27 @@ public:
 
     ChatCommandTable GetCommands() const override
     {
+        static ChatCommandTable captureDebugCommandTable =
+        {
+            { "stats",      HandleDebugStatsCommand,     SEC_ADMINISTRATOR, Console::Yes },
+            { "statbench",  HandleDebugStatBenchCommand, SEC_ADMINISTRATOR, Console::Yes },
+            { "protobench", HandleDebugProtoBenchCommand, SEC_ADMINISTRATOR, Console::Yes },
+        };
+
+        static ChatCommandTable captureAuditCommandTable =
+        {
+            { "report",     HandleAuditReportCommand,    SEC_ADMINISTRATOR, Console::Yes },
+            { "repair",     HandleAuditRepairCommand,    SEC_ADMINISTRATOR, Console::Yes },
+            { "status",     HandleAuditStatusCommand,    SEC_ADMINISTRATOR, Console::Yes },
+            { "stop",       HandleAuditStopCommand,      SEC_ADMINISTRATOR, Console::Yes },
+        };
+
+        static ChatCommandTable captureReloadCommandTable =
+        {
+            { "rules",      HandleReloadRulesCommand,    SEC_ADMINISTRATOR, Console::Yes },
+            { "tables",     HandleReloadTablesCommand,   SEC_ADMINISTRATOR, Console::Yes },
+        };
+
         static ChatCommandTable captureCommandTable =
         {
             { "",           HandleCaptureCommand,        SEC_PLAYER,        Console::No },
@@ -3588,8 +7142,13 @@ public:
             { "teach",      HandleTeachCommand,          SEC_PLAYER,        Console::No },
             { "unlearn",    HandleUnlearnCommand,        SEC_PLAYER,        Console::No },
             { "swap",       HandleSwapCommand,           SEC_PLAYER,        Console::No },
+            { "loadout",    HandleLoadoutCommand,        SEC_PLAYER,        Console::No },
             { "feed",       HandleFeedCommand,           SEC_PLAYER,        Console::No },
             { "feedpreview", HandleFeedPreviewCommand,   SEC_PLAYER,        Console::No },
+            { "sync",       HandleSyncCommand,           SEC_PLAYER,        Console::No },
+            { "reload",     captureReloadCommandTable },
+            { "audit",      captureAuditCommandTable },
+            { "debug",      captureDebugCommandTable },
         };
 
         static ChatCommandTable commandTable =
@@ -3600,6 +7159,277 @@ public:
         return commandTable;
     }
 
+    static bool StartAudit(ChatHandler* handler, bool repair)
+    {
+        if (!s_audit.Start(repair))
+        {
+            handler->PSendSysMessage("A guardian audit is already running; see .capture audit status.");
+            return true;
+        }
+        handler->PSendSysMessage("Guardian audit started ({}). Issues go to the server log; see .capture audit status.",
+            repair ? "repairing rows of offline owners" : "report only");
+        return true;
+    }
+
+    static bool HandleAuditReportCommand(ChatHandler* handler) { return StartAudit(handler, false); }
+    static bool HandleAuditRepairCommand(ChatHandler* handler) { return StartAudit(handler, true); }
+
+    static bool HandleAuditStatusCommand(ChatHandler* handler)
+    {
+        s_audit.Report(handler);
+        return true;
+    }
+
+    static bool HandleAuditStopCommand(ChatHandler* handler)
+    {
+        s_audit.Stop();
+        s_audit.Report(handler);
+        return true;
+    }
+
+    static bool HandleReloadRulesCommand(ChatHandler* handler)
+    {
+        uint32 count = s_zoneRules.Load();
+        handler->PSendSysMessage("Reloaded {} creature capture zone rules.", count);
+        return true;
+    }
+
+    // Commands may run on a map thread, so the rebuild waits for the world update
+    static bool HandleReloadTablesCommand(ChatHandler* handler)
+    {
+        s_tableCache.RequestRebuild();
+        handler->PSendSysMessage("Creature capture spell tables will be rebuilt on the next world update.");
+        return true;
+    }
+
+    static bool HandleDebugStatsCommand(ChatHandler* handler)
+    {
+        auto Get = [](std::atomic<uint64> const& c) { return c.load(std::memory_order_relaxed); };
+
+        handler->PSendSysMessage("Creature capture metrics:");
+        handler->PSendSysMessage("  event log: {} queued, {} dropped, {} batches written, {} rotations",
+            Get(metrics.eventsLogged), Get(metrics.eventsDropped), Get(metrics.eventBatches), Get(metrics.eventRotations));
+        handler->PSendSysMessage("  feed preview: {} requests, {} served, {} cache hits, {} coalesced",
+            Get(metrics.feedPreviewRequests), Get(metrics.feedPreviewServed),
+            Get(metrics.feedPreviewCacheHits), Get(metrics.feedPreviewDropped));
+        handler->PSendSysMessage("  login load: {} batched queries for {} owners, {} single-owner queries",
+            Get(metrics.loginBatches), Get(metrics.loginBatchOwners), Get(metrics.loginSingleLoads));
+        handler->PSendSysMessage("  dormancy: {} guardians dormant now, {} entries, {} wakes",
+            Get(metrics.dormantGuardians), Get(metrics.dormancyEntries), Get(metrics.dormancyWakes));
+        uint64 tankMs = Get(metrics.tankActiveMs);
+        handler->PSendSysMessage("  tank threat ({}): {} mutations over {:.1f} tank-seconds ({:.2f}/tank/s), {} held, {} rate-limited",
+            config.tankThreatDelta ? "delta" : "flat", Get(metrics.threatMutations), tankMs / 1000.0,
+            tankMs ? Get(metrics.threatMutations) * 1000.0 / tankMs : 0.0,
+            Get(metrics.threatHeldSkips), Get(metrics.threatRateSkips));
+        handler->PSendSysMessage("  addon outbox: {} messages queued, {} superseded, {} packets sent",
+            Get(metrics.outboxQueued), Get(metrics.outboxSuperseded), Get(metrics.outboxPackets));
+        handler->PSendSysMessage("  parallel AI ({}): {} batches, {} decisions, {} cast, {} us deciding",
+            s_aiBatch.Active() ? "active" : "inline", Get(metrics.aiBatches), Get(metrics.aiBatchDecisions),
+            Get(metrics.aiBatchApplied), Get(metrics.aiDecideUs));
+        uint64 warmHits = Get(metrics.warmHits);
+        uint64 warmLookups = warmHits + Get(metrics.warmMisses);
+        handler->PSendSysMessage("  warm cache: {} entries, {}/{} logins hit ({:.1f}%), {} queries saved, {} stale, {} evicted",
+            s_warmCache.Size(), warmHits, warmLookups, warmLookups ? warmHits * 100.0 / warmLookups : 0.0,
+            warmHits, Get(metrics.warmStale), Get(metrics.warmEvictions));
+        uint64 laneWritten = Get(metrics.laneWritten);
+        handler->PSendSysMessage("  write lane: {} pending, {} queued, {} coalesced, {} overflowed, {} written, latency avg {} ms / max {} ms",
+            Get(metrics.laneDepth), Get(metrics.laneQueued), Get(metrics.laneCoalesced), Get(metrics.laneOverflow), laneWritten,
+            laneWritten ? Get(metrics.laneLatencySumMs) / laneWritten : 0, Get(metrics.laneLatencyMaxMs));
+        return true;
+    }
+
+    // Time the derived-stat batch kernel against the per-slot scalar path on
+    // synthetic guardians. Touches no live data.
+    static bool HandleDebugStatBenchCommand(ChatHandler* handler, Optional<uint32> countArg)
+    {
+        uint32 count = std::clamp<uint32>(countArg.value_or(10000), 1, 1000000);
+
+        std::vector<GuardianSlotData> slots(count);
+        for (GuardianSlotData& s : slots)
+        {
+            s.bonusStrength    = irand(0, 500);
+            s.bonusAgility     = irand(0, 500);
+            s.bonusIntellect   = irand(-50, 500);
+            s.bonusStamina     = irand(-100, 800);
+            s.bonusAttackPower = irand(0, 1000);
+            s.bonusSpellPower  = irand(0, 1000);
+            s.bonusCritRating  = irand(0, 300);
+            s.bonusDodgeRating = irand(0, 300);
+            s.bonusParryRating = irand(0, 300);
+            s.bonusHasteRating = irand(0, 300);
+            s.bonusBlockRating = irand(0, 300);
+        }
+
+        using Clock = std::chrono::steady_clock;
+        auto Micros = [](Clock::duration d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+
+        Clock::time_point t0 = Clock::now();
+        for (GuardianSlotData& s : slots)
+            RefreshDerivedStats(s);
+        Clock::time_point t1 = Clock::now();
+
+        GuardianStatBatch batch;
+        batch.Resize(count);
+        for (uint32 i = 0; i < count; ++i)
+            batch.Load(i, slots[i]);
+        Clock::time_point t2 = Clock::now();
+        batch.Compute();
+        Clock::time_point t3 = Clock::now();
+        for (uint32 i = 0; i < count; ++i)
+            batch.Store(i, slots[i].derived);
+        Clock::time_point t4 = Clock::now();
+
+        // Both paths share the formulas; any disagreement is a bug
+        uint32 mismatches = 0;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            GuardianDerivedStats batched = slots[i].derived;
+            RefreshDerivedStats(slots[i]);
+            GuardianDerivedStats const& d = slots[i].derived;
+            if (batched.health != d.health || batched.mana != d.mana || batched.meleeAP != d.meleeAP
+                || batched.rangedAP != d.rangedAP || batched.spellPower != d.spellPower || batched.critPct != d.critPct
+                || batched.dodgePct != d.dodgePct || batched.parryPct != d.parryPct || batched.blockPct != d.blockPct
+                || batched.hastePct != d.hastePct)
+                ++mismatches;
+        }
+
+        handler->PSendSysMessage("Derived stats for {} synthetic guardians:", count);
+        handler->PSendSysMessage("  scalar: {} us", Micros(t1 - t0));
+        handler->PSendSysMessage("  batch:  {} us (load {} us, kernel {} us, store {} us)",
+            Micros(t4 - t1), Micros(t2 - t1), Micros(t3 - t2), Micros(t4 - t3));
+        handler->PSendSysMessage("  scalar/batch mismatches: {}", mismatches);
+        return true;
+    }
+
+    // Encodes every addon message type with the live encoders over synthetic
+    // guardians, then packs a typical stream the way the outbox does. Run
+    // in game, it also sends one sample of each message to the addon, where
+    // /ccapture bench decodes them with the addon's own parsers.
+    static bool HandleDebugProtoBenchCommand(ChatHandler* handler, Optional<uint32> countArg)
+    {
+        uint32 count = std::clamp<uint32>(countArg.value_or(10000), 1, 1000000);
+
+        static char const* const NAMES[] = { "Defias Pillager", "Murloc Tidehunter", "Scarlet Sorcerer", "Blackrock Shadowcaster" };
+
+        std::vector<GuardianSlotData> slots(count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            GuardianSlotData& s = slots[i];
+            s.guardianEntry     = urand(1, 40000);
+            s.guardianLevel     = urand(1, 80);
+            s.guardianHealth    = urand(100, 40000);
+            s.guardianPower     = urand(0, 20000);
+            s.guardianPowerType = urand(0, 1) ? POWER_MANA : POWER_RAGE;
+            s.archetype         = urand(ARCHETYPE_DPS, ARCHETYPE_HEALER);
+            s.guardianGuid      = ObjectGuid::Create<HighGuid::Unit>(s.guardianEntry, urand(1, 2000000));
+            s.version           = urand(1, 500);
+            for (uint32 j = 0; j < MAX_GUARDIAN_SPELLS; ++j)
+                s.spellSlots[j] = urand(0, 3) ? urand(1, 70000) : 0;
+            s.bonusStrength     = irand(0, 500);
+            s.bonusAgility      = irand(0, 500);
+            s.bonusIntellect    = irand(0, 500);
+            s.bonusStamina      = irand(0, 800);
+            s.bonusAttackPower  = irand(0, 1000);
+            s.bonusSpellPower   = irand(0, 1000);
+            s.bonusCritRating   = irand(0, 300);
+            s.bonusHasteRating  = irand(0, 300);
+            s.bonusArmor        = urand(0, 2000);
+            s.bonusWeaponDmg    = frand(0.0f, 50.0f);
+            s.bonusResFire      = irand(0, 100);
+        }
+
+        using Clock = std::chrono::steady_clock;
+        std::vector<std::string> samples;
+
+        handler->PSendSysMessage("Addon protocol, {} messages per type (bytes include the {}-byte prefix):",
+            count, sizeof(ADDON_PREFIX));
+
+        auto Bench = [&](char const* tag, auto encode)
+        {
+            uint64 bytes = 0;
+            Clock::time_point start = Clock::now();
+            for (uint32 i = 0; i < count; ++i)
+                bytes += encode(slots[i], uint8(i % MAX_GUARDIAN_SLOTS)).size();
+            uint64 ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+
+            samples.push_back(encode(slots[0], 0));
+            handler->PSendSysMessage("  {:<12} {:>4} B/msg {:>6} ns/msg", tag, bytes / count, ns / count);
+        };
+
+        Bench("SPELLS",  [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianSpells(slot, s.spellSlots); });
+        Bench("ARCH",    [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianArchetype(slot, s.archetype); });
+        Bench("NAME",    [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianName(slot, NAMES[s.guardianEntry % 4]); });
+        Bench("GUID",    [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianGuid(slot, s.guardianGuid); });
+        Bench("POWER",   [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianPower(slot, s.guardianPowerType); });
+        Bench("ENTRY",   [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianEntry(slot, s.guardianEntry); });
+        Bench("HPOW",    [](GuardianSlotData const& s, uint8 slot)
+        {
+            return EncodeGuardianHealthPower(slot, s.guardianHealth, s.guardianHealth + 500, s.guardianPower, 20000, s.guardianPowerType);
+        });
+        Bench("BONUS",   [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianBonuses(slot, s); });
+        Bench("FEEDPREVIEW", [](GuardianSlotData const& s, uint8 slot) { return EncodeFeedPreview(slot, 40000 + s.guardianEntry, s); });
+        Bench("VER",     [](GuardianSlotData const& s, uint8 slot) { return EncodeGuardianVersion(slot, 1700000000, s.version); });
+        Bench("DISMISS", [](GuardianSlotData const&, uint8 slot) { return EncodeGuardianDismiss(slot); });
+        Bench("CLEAR",   [](GuardianSlotData const&, uint8 slot) { return EncodeGuardianClear(slot); });
+
+        // A typical owner-second with four guardians out: four HPOW syncs,
+        // a leech BONUS+VER every 10th second, a full slot state every 60th
+        uint32 seconds = std::max<uint32>(count / MAX_GUARDIAN_SLOTS, 1);
+        uint64 messages = 0, rawBytes = 0, packets = 0, packedBytes = 0;
+        std::vector<AddonOutbox::Pending> update;
+        std::vector<std::string> packed;
+        for (uint32 sec = 0; sec < seconds; ++sec)
+        {
+            update.clear();
+            auto Add = [&](std::string msg) { update.push_back({ std::string(), msg.substr(sizeof(ADDON_PREFIX)) }); };
+
+            for (uint8 slot = 0; slot < MAX_GUARDIAN_SLOTS; ++slot)
+            {
+                GuardianSlotData const& s = slots[(sec * MAX_GUARDIAN_SLOTS + slot) % count];
+                Add(EncodeGuardianHealthPower(slot, s.guardianHealth, s.guardianHealth + 500, s.guardianPower, 20000, s.guardianPowerType));
+            }
+
+            GuardianSlotData const& s = slots[sec % count];
+            uint8 slot = uint8(sec % MAX_GUARDIAN_SLOTS);
+            if (sec % 60 == 0)
+            {
+                Add(EncodeGuardianName(slot, NAMES[s.guardianEntry % 4]));
+                Add(EncodeGuardianArchetype(slot, s.archetype));
+                Add(EncodeGuardianSpells(slot, s.spellSlots));
+                Add(EncodeGuardianPower(slot, s.guardianPowerType));
+                Add(EncodeGuardianEntry(slot, s.guardianEntry));
+                Add(EncodeGuardianBonuses(slot, s));
+                Add(EncodeGuardianGuid(slot, s.guardianGuid));
+                Add(EncodeGuardianVersion(slot, 1700000000, s.version));
+            }
+            else if (sec % 10 == 0)
+            {
+                Add(EncodeGuardianBonuses(slot, s));
+                Add(EncodeGuardianVersion(slot, 1700000000, s.version));
+            }
+
+            packed.clear();
+            AddonOutbox::Pack(update, packed);
+            messages += update.size();
+            for (AddonOutbox::Pending const& p : update)
+                rawBytes += sizeof(ADDON_PREFIX) + p.body.size();
+            packets += packed.size();
+            for (std::string const& packet : packed)
+                packedBytes += packet.size();
+        }
+
+        handler->PSendSysMessage("Typical stream, {} owner-seconds: {} msgs, {} B unpacked -> {} packets, {} B ({:.2f} msgs/packet)",
+            seconds, messages, rawBytes, packets, packedBytes, double(messages) / double(std::max<uint64>(packets, 1)));
+
+        if (Player* player = handler->GetSession() ? handler->GetSession()->GetPlayer() : nullptr)
+        {
+            for (std::string const& sample : samples)
+                SendCaptureAddonMessage(player, std::string(ADDON_PREFIX) + "\tBENCHSAMPLE:" + sample.substr(sizeof(ADDON_PREFIX)));
+            handler->PSendSysMessage("Sent {} sample messages to your addon; run /ccapture bench to time the decoders.", samples.size());
+        }
+        return true;
+    }
+
     static bool HandleCaptureCommand(ChatHandler* handler, Optional<PlayerIdentifier> /*target*/)
     {
         if (!config.enabled)
@@ -3621,7 +7451,13 @@ public:
             return true;
         }
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        if (IsGuardianLoginPending(player))
+        {
+            handler->PSendSysMessage("Your guardians are still loading. Try again in a moment.");
+            return true;
+        }
+
+        CapturedGuardianData* data = GetGuardianData(player);
         int8 emptySlot = data->FindEmptySlot();
         if (emptySlot < 0)
         {
@@ -3647,7 +7483,13 @@ public:
             return true;
         }
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        if (IsGuardianLoginPending(player))
+        {
+            handler->PSendSysMessage("Your guardians are still loading. Try again in a moment.");
+            return true;
+        }
+
+        CapturedGuardianData* data = GetGuardianData(player);
         int8 emptySlot = data->FindEmptySlot();
         if (emptySlot < 0)
         {
@@ -3688,6 +7530,7 @@ public:
         handler->PSendSysMessage("GM captured {} (Entry {}) in slot {} at level {}.",
             cInfo->Name, creatureEntry, emptySlot + 1, level);
 
+        ++s.version;
         SendFullSlotState(player, static_cast<uint8>(emptySlot), s);
 
         return true;
@@ -3699,7 +7542,7 @@ public:
         if (!player)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
         int8 slot = FindTargetedGuardianSlot(player, data);
 
         if (slot < 0)
@@ -3726,7 +7569,7 @@ public:
         if (!player)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = GetGuardianData(player);
         int8 slot = FindTargetedGuardianSlot(player, data);
 
         if (slot >= 0)
@@ -3846,7 +7689,7 @@ public:
         if (!player)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
         int8 guardianSlot = FindTargetedGuardianSlot(player, data);
 
         if (guardianSlot < 0)
@@ -3876,44 +7719,10 @@ public:
         }
 
         SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-        if (!spellInfo)
-        {
-            handler->PSendSysMessage("|cffff0000[Guardian]|r Spell does not exist.");
-            return true;
-        }
-
-        // Require a resource type to be chosen before teaching spells with a power cost
-        bool hasPowerCost = spellInfo->PowerType != POWER_HEALTH &&
-            (spellInfo->ManaCost > 0 || spellInfo->ManaCostPercentage > 0);
-        if (hasPowerCost && !s.powerChosen)
-        {
-            handler->PSendSysMessage("|cffff0000[Guardian]|r Choose a resource type for this guardian before teaching spells that cost resources.");
-            return true;
-        }
-
-        // Check power type compatibility
-        if (spellInfo->PowerType != POWER_HEALTH &&
-            spellInfo->ManaCost > 0 &&
-            static_cast<uint8>(spellInfo->PowerType) != guardian->getPowerType())
-        {
-            std::string powerName;
-            switch (spellInfo->PowerType)
-            {
-                case POWER_MANA:   powerName = "Mana"; break;
-                case POWER_RAGE:   powerName = "Rage"; break;
-                case POWER_ENERGY: powerName = "Energy"; break;
-                case POWER_FOCUS:  powerName = "Focus"; break;
-                default:           powerName = "an unknown resource"; break;
-            }
-            handler->PSendSysMessage("|cffff0000[Guardian]|r This guardian cannot use {} spells.", powerName);
-            return true;
-        }
-
-        if (spellInfo->PowerType != POWER_HEALTH &&
-            spellInfo->ManaCostPercentage > 0 &&
-            static_cast<uint8>(spellInfo->PowerType) != guardian->getPowerType())
+        std::string error;
+        if (!CanGuardianLearnSpell(spellInfo, s, guardian, error))
         {
-            handler->PSendSysMessage("|cffff0000[Guardian]|r This guardian lacks the required resource for this spell.");
+            handler->PSendSysMessage("|cffff0000[Guardian]|r {}", error);
             return true;
         }
 
@@ -3930,6 +7739,7 @@ public:
             spellInfo->SpellName[0], slot);
 
         SendGuardianSpells(player, static_cast<uint8>(guardianSlot), s.spellSlots);
+        BumpSlotVersion(player, static_cast<uint8>(guardianSlot));
 
         return true;
     }
@@ -3940,7 +7750,7 @@ public:
         if (!player)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
         int8 guardianSlot = FindTargetedGuardianSlot(player, data);
 
         if (guardianSlot < 0)
@@ -3991,17 +7801,74 @@ public:
         handler->PSendSysMessage("|cff00ff00[Guardian]|r Unlearned {} from slot {}.", spellName, slot);
 
         SendGuardianSpells(player, static_cast<uint8>(guardianSlot), s.spellSlots);
+        BumpSlotVersion(player, static_cast<uint8>(guardianSlot));
+
+        return true;
+    }
+
+    static bool HandleSwapCommand(ChatHandler* handler, uint32 slot1, uint32 slot2)
+    {
+        Player* player = handler->GetSession()->GetPlayer();
+        if (!player)
+            return false;
+
+        CapturedGuardianData* data = FindGuardianData(player);
+        int8 guardianSlot = FindTargetedGuardianSlot(player, data);
+
+        if (guardianSlot < 0)
+        {
+            handler->PSendSysMessage("|cffff0000[Guardian]|r Target one of your guardians first.");
+            return true;
+        }
+
+        GuardianSlotData& s = data->slots[guardianSlot];
+        if (!s.IsActive())
+        {
+            handler->PSendSysMessage("|cffff0000[Guardian]|r That guardian is not currently summoned.");
+            return true;
+        }
+
+        if (slot1 < 1 || slot1 > MAX_GUARDIAN_SPELLS || slot2 < 1 || slot2 > MAX_GUARDIAN_SPELLS || slot1 == slot2)
+        {
+            handler->PSendSysMessage("|cffff0000[Guardian]|r Invalid slots (1-{}).", MAX_GUARDIAN_SPELLS);
+            return true;
+        }
+
+        uint32 idx1 = slot1 - 1;
+        uint32 idx2 = slot2 - 1;
+
+        std::swap(s.spellSlots[idx1], s.spellSlots[idx2]);
+
+        Creature* guardian = ObjectAccessor::GetCreature(*player, s.guardianGuid);
+        if (guardian)
+        {
+            CapturedGuardianAI* ai = dynamic_cast<CapturedGuardianAI*>(guardian->AI());
+            if (ai)
+            {
+                ai->SetSpell(idx1, s.spellSlots[idx1]);
+                ai->SetSpell(idx2, s.spellSlots[idx2]);
+            }
+        }
+
+        SaveGuardianSlotToDb(player, &s, static_cast<uint8>(guardianSlot));
+        SendGuardianSpells(player, static_cast<uint8>(guardianSlot), s.spellSlots);
+        BumpSlotVersion(player, static_cast<uint8>(guardianSlot));
 
         return true;
     }
 
-    static bool HandleSwapCommand(ChatHandler* handler, uint32 slot1, uint32 slot2)
+    // Apply all eight spell slots in one request. Spells new to this guardian
+    // go through the same checks as .capture teach; spells it already knows
+    // may be moved freely. Any failure rejects the whole edit and re-sends the
+    // current loadout so the addon can roll back its local copy.
+    static bool HandleLoadoutCommand(ChatHandler* handler, uint32 s1, uint32 s2, uint32 s3, uint32 s4,
+        uint32 s5, uint32 s6, uint32 s7, uint32 s8)
     {
         Player* player = handler->GetSession()->GetPlayer();
         if (!player)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
         int8 guardianSlot = FindTargetedGuardianSlot(player, data);
 
         if (guardianSlot < 0)
@@ -4011,37 +7878,58 @@ public:
         }
 
         GuardianSlotData& s = data->slots[guardianSlot];
-        if (!s.IsActive())
+        Creature* guardian = s.IsActive() ? ObjectAccessor::GetCreature(*player, s.guardianGuid) : nullptr;
+        if (!guardian)
         {
             handler->PSendSysMessage("|cffff0000[Guardian]|r That guardian is not currently summoned.");
             return true;
         }
 
-        if (slot1 < 1 || slot1 > MAX_GUARDIAN_SPELLS || slot2 < 1 || slot2 > MAX_GUARDIAN_SPELLS || slot1 == slot2)
+        uint32 const loadout[MAX_GUARDIAN_SPELLS] = { s1, s2, s3, s4, s5, s6, s7, s8 };
+
+        for (uint32 i = 0; i < MAX_GUARDIAN_SPELLS; ++i)
         {
-            handler->PSendSysMessage("|cffff0000[Guardian]|r Invalid slots (1-{}).", MAX_GUARDIAN_SPELLS);
-            return true;
-        }
+            uint32 spellId = loadout[i];
+            if (!spellId)
+                continue;
 
-        uint32 idx1 = slot1 - 1;
-        uint32 idx2 = slot2 - 1;
+            // Only duplicates the edit introduces are rejected. Guardians taught
+            // the same spell twice before this check existed keep their copies,
+            // so their loadout stays editable.
+            auto firstRepeat = std::find(loadout, loadout + i, spellId);
+            if (firstRepeat != loadout + i &&
+                std::count(loadout, loadout + i + 1, spellId) > std::count(std::begin(s.spellSlots), std::end(s.spellSlots), spellId))
+            {
+                handler->PSendSysMessage("|cffff0000[Guardian]|r Loadout rejected: slot {} repeats slot {}.",
+                    i + 1, uint32(firstRepeat - loadout) + 1);
+                SendGuardianSpells(player, static_cast<uint8>(guardianSlot), s.spellSlots);
+                return true;
+            }
 
-        std::swap(s.spellSlots[idx1], s.spellSlots[idx2]);
+            if (std::find(std::begin(s.spellSlots), std::end(s.spellSlots), spellId) != std::end(s.spellSlots))
+                continue;
 
-        Creature* guardian = ObjectAccessor::GetCreature(*player, s.guardianGuid);
-        if (guardian)
-        {
-            CapturedGuardianAI* ai = dynamic_cast<CapturedGuardianAI*>(guardian->AI());
-            if (ai)
+            std::string error;
+            if (!CanGuardianLearnSpell(sSpellMgr->GetSpellInfo(spellId), s, guardian, error))
             {
-                ai->SetSpell(idx1, s.spellSlots[idx1]);
-                ai->SetSpell(idx2, s.spellSlots[idx2]);
+                handler->PSendSysMessage("|cffff0000[Guardian]|r Loadout rejected: slot {}: {}", i + 1, error);
+                SendGuardianSpells(player, static_cast<uint8>(guardianSlot), s.spellSlots);
+                return true;
             }
         }
 
+        if (std::equal(std::begin(loadout), std::end(loadout), std::begin(s.spellSlots)))
+            return true;
+
+        if (CapturedGuardianAI* ai = dynamic_cast<CapturedGuardianAI*>(guardian->AI()))
+            ai->SetSpells(loadout);
+
+        memcpy(s.spellSlots, loadout, sizeof(s.spellSlots));
         SaveGuardianSlotToDb(player, &s, static_cast<uint8>(guardianSlot));
         SendGuardianSpells(player, static_cast<uint8>(guardianSlot), s.spellSlots);
+        BumpSlotVersion(player, static_cast<uint8>(guardianSlot));
 
+        handler->PSendSysMessage("|cff00ff00[Guardian]|r Loadout updated.");
         return true;
     }
 
@@ -4051,7 +7939,7 @@ public:
         if (!player)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
         int8 guardianSlot = FindTargetedGuardianSlot(player, data);
 
         if (guardianSlot < 0)
@@ -4103,6 +7991,8 @@ public:
         int32 oldResFr = s.bonusResFrost, oldResS = s.bonusResShadow, oldResA = s.bonusResArcane;
 
         ExtractItemBonuses(item, s);
+        RefreshDerivedStats(s);
+        LogCaptureEvent(CAPTURE_EVENT_FEED, player, static_cast<uint8>(guardianSlot), s, itemEntry);
 
         // Destroy one copy of the item
         player->DestroyItemCount(itemEntry, 1, true);
@@ -4162,19 +8052,22 @@ public:
 
         SaveGuardianSlotToDb(player, &s, static_cast<uint8>(guardianSlot));
         SendGuardianBonuses(player, static_cast<uint8>(guardianSlot), s);
+        BumpSlotVersion(player, static_cast<uint8>(guardianSlot));
 
         handler->PSendSysMessage("|cff00ff00[Guardian]|r Fed {} to guardian in slot {}.", itemName, guardianSlot + 1);
 
         return true;
     }
 
+    // Cheap checks, including the bag lookup, run per request; the bonus
+    // extraction is deferred to ServeFeedPreview so bursts collapse into one reply.
     static bool HandleFeedPreviewCommand(ChatHandler* handler, uint32 itemEntry)
     {
         Player* player = handler->GetSession()->GetPlayer();
         if (!player)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
         int8 guardianSlot = FindTargetedGuardianSlot(player, data);
 
         if (guardianSlot < 0)
@@ -4196,58 +8089,281 @@ public:
             return true;
         }
 
-        Item* item = player->GetItemByEntry(itemEntry);
+        metrics.feedPreviewRequests.fetch_add(1, std::memory_order_relaxed);
+
+        // The bag and level checks are cheap and can change between requests,
+        // so they run before the cache is consulted.
+        Item* item = FindFeedPreviewItem(player, proto, data->slots[guardianSlot]);
         if (!item)
+            return true;
+
+        FeedPreviewState& fp = data->feedPreview;
+        if (FeedPreviewState::CacheEntry const* cached = fp.Find(guardianSlot, itemEntry, item->GetItemRandomPropertyId(),
+            GameTime::GetGameTimeMS().count()))
         {
-            handler->PSendSysMessage("|cffff0000[Guardian]|r You don't have that item.");
+            metrics.feedPreviewCacheHits.fetch_add(1, std::memory_order_relaxed);
+            SendCaptureAddonMessage(player, cached->payload);
             return true;
         }
 
-        GuardianSlotData& s = data->slots[guardianSlot];
+        if (fp.pendingItem)
+            metrics.feedPreviewDropped.fetch_add(1, std::memory_order_relaxed);
 
-        if (proto->RequiredLevel > 0 &&
-            static_cast<int32>(proto->RequiredLevel) > static_cast<int32>(s.guardianLevel) + 15)
+        fp.pendingItem  = itemEntry;
+        fp.pendingSlot  = static_cast<uint8>(guardianSlot);
+        fp.pendingTimer = static_cast<int32>(config.feedPreviewDelayMs);
+
+        if (fp.pendingTimer <= 0)
+            ServeFeedPreview(player, data);
+
+        return true;
+    }
+
+    // Sent by the addon after a UI reload with the slot versions it cached.
+    // Only slots whose version (or the whole epoch) differs are resent.
+    static bool HandleSyncCommand(ChatHandler* handler, uint32 epoch, uint32 v0, uint32 v1, uint32 v2, uint32 v3)
+    {
+        Player* player = handler->GetSession()->GetPlayer();
+        if (!player)
+            return false;
+
+        uint32 const seen[MAX_GUARDIAN_SLOTS] = { v0, v1, v2, v3 };
+        CapturedGuardianData* data = FindGuardianData(player);
+
+        for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
         {
-            handler->PSendSysMessage("|cffff0000[Guardian]|r Item level requirement too high for this guardian.");
-            return true;
-        }
+            if (!data)
+            {
+                // Nothing held server-side: wipe whatever the addon cached
+                if (epoch != 0 || seen[i] != 0)
+                {
+                    SendGuardianClear(player, i);
+                    SendGuardianVersion(player, i, 0, 0);
+                }
+                continue;
+            }
+
+            GuardianSlotData const& s = data->slots[i];
+            if (epoch == data->epoch && seen[i] == s.version)
+                continue;
 
-        // Compute preview by extracting into a temporary slot copy
-        GuardianSlotData preview;
-        memset(&preview, 0, sizeof(preview));
-        ExtractItemBonuses(item, preview);
-
-        // Send FEEDPREVIEW addon message with new stat format
-        std::ostringstream ss;
-        ss << ADDON_PREFIX << "\tFEEDPREVIEW:" << (uint32)guardianSlot
-           << ":" << itemEntry
-           << ":" << preview.bonusStrength
-           << ":" << preview.bonusAgility
-           << ":" << preview.bonusIntellect
-           << ":" << preview.bonusStamina
-           << ":" << preview.bonusAttackPower
-           << ":" << preview.bonusSpellPower
-           << ":" << preview.bonusCritRating
-           << ":" << preview.bonusDodgeRating
-           << ":" << preview.bonusParryRating
-           << ":" << preview.bonusHasteRating
-           << ":" << preview.bonusHitRating
-           << ":" << preview.bonusBlockRating
-           << ":" << preview.bonusBlockValue
-           << ":" << preview.bonusArmor
-           << ":" << std::fixed << std::setprecision(1) << preview.bonusWeaponDmg
-           << ":" << preview.bonusResHoly
-           << ":" << preview.bonusResFire
-           << ":" << preview.bonusResNature
-           << ":" << preview.bonusResFrost
-           << ":" << preview.bonusResShadow
-           << ":" << preview.bonusResArcane;
-        SendCaptureAddonMessage(player, ss.str());
+            // Clear first so nothing cached (e.g. a dead GUID) outlives the resend
+            SendGuardianClear(player, i);
+            if (s.IsOccupied() && i < config.maxSlots)
+                SendFullSlotState(player, i, s);
+            else
+                SendGuardianVersion(player, i, data->epoch, s.version);
+        }
 
         return true;
     }
 };
 
+// ============================================================================
+// Login Load Batcher — one character_guardian query per burst of logins
+// ============================================================================
+
+// Summon or announce each loaded slot once the player's guardians are in memory.
+static void FinishGuardianLogin(Player* player)
+{
+    CapturedGuardianData* data = FindGuardianData(player);
+    bool anyOccupied = false;
+    for (uint8 i = 0; data && i < config.maxSlots; ++i)
+    {
+        GuardianSlotData& s = data->slots[i];
+        if (!s.IsOccupied())
+            continue;
+
+        anyOccupied = true;
+        CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(s.guardianEntry);
+        std::string name = cInfo ? cInfo->Name : "Guardian";
+
+        if (!s.dismissed)
+        {
+            // Auto-summon guardians that were not explicitly dismissed
+            if (SummonGuardianSlot(player, i, false))
+            {
+                ChatHandler(player->GetSession()).PSendSysMessage(
+                    "|cff00ff00[Creature Capture]|r Slot {}: {} ({}) summoned.",
+                    i + 1, name, ArchetypeName(s.archetype));
+            }
+        }
+        else
+        {
+            ChatHandler(player->GetSession()).PSendSysMessage(
+                "|cff00ff00[Creature Capture]|r Slot {}: {} ({}) stored in Tesseract.",
+                i + 1, name, ArchetypeName(s.archetype));
+        }
+    }
+
+    if (anyOccupied)
+    {
+        SendAllSlotsState(player);
+    }
+    else if (config.announce)
+    {
+        ChatHandler(player->GetSession()).PSendSysMessage(
+            "|cff00ff00[Creature Capture]|r Target a creature and use your Tesseract to capture it!");
+    }
+}
+
+// Owners logging in within LoginBatch.WindowMs of each other share a single
+// "WHERE owner IN (...)" query instead of one synchronous query each. Rows are
+// handed back to whichever of those players are still online when the result
+// arrives; a window that closes with one owner falls back to the plain
+// per-owner query. Owners whose last session's saves are still in the write
+// lane are held back until those commit, so the load never reads stale rows.
+class GuardianLoginBatcher
+{
+public:
+    void EnqueueAfterWrites(Player* player)
+    {
+        _loading.insert(player->GetGUID());
+        // A cancelled wait may still be listed if the player relogged quickly
+        if (std::find(_waitingOnWrites.begin(), _waitingOnWrites.end(), player->GetGUID()) == _waitingOnWrites.end())
+            _waitingOnWrites.push_back(player->GetGUID());
+    }
+
+    void Enqueue(Player* player)
+    {
+        if (_pending.empty())
+            _windowTimer = config.loginBatchWindowMs;
+
+        _loading.insert(player->GetGUID());
+        _pending.push_back(player->GetGUID());
+        if (_pending.size() >= config.loginBatchMaxSize)
+            Flush();
+    }
+
+    void Update(uint32 diff)
+    {
+        if (!_waitingOnWrites.empty())
+            ReleaseDrainedOwners();
+
+        if (!_pending.empty())
+        {
+            if (_windowTimer <= diff)
+                Flush();
+            else
+                _windowTimer -= diff;
+        }
+
+        _callbacks.ProcessReadyCallbacks();
+    }
+
+    // True while the player's saved slots are still on their way.
+    bool IsLoading(ObjectGuid guid) const { return _loading.count(guid) != 0; }
+
+    // Player left before the result arrived; drop whatever comes back for them.
+    void Cancel(ObjectGuid guid) { _loading.erase(guid); }
+
+private:
+    void ReleaseDrainedOwners()
+    {
+        std::vector<ObjectGuid> waiting;
+        waiting.swap(_waitingOnWrites);
+        for (ObjectGuid const& guid : waiting)
+        {
+            if (!IsLoading(guid))
+                continue;   // cancelled
+
+            Player* player = ObjectAccessor::FindPlayer(guid);
+            if (!player)
+            {
+                _loading.erase(guid);
+                continue;
+            }
+
+            if (s_writeLane.HasPending(guid.GetCounter()))
+            {
+                _waitingOnWrites.push_back(guid);
+                continue;
+            }
+
+            if (config.loginBatchEnabled)
+                Enqueue(player);
+            else
+            {
+                _loading.erase(guid);
+                LoadGuardiansFromDb(player);
+                FinishGuardianLogin(player);
+            }
+        }
+    }
+
+    void Flush()
+    {
+        CC_PROFILE_ZONE("GuardianLoginBatcher::Flush");
+        std::vector<ObjectGuid> owners;
+        owners.swap(_pending);
+
+        std::string sql;
+        if (owners.size() == 1)
+        {
+            sql = Acore::StringFormat("SELECT owner, {} FROM character_guardian WHERE owner = {}",
+                GUARDIAN_LOAD_COLUMNS, owners.front().GetCounter());
+            metrics.loginSingleLoads.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            std::ostringstream in;
+            for (size_t i = 0; i < owners.size(); ++i)
+            {
+                if (i)
+                    in << ',';
+                in << owners[i].GetCounter();
+            }
+            sql = Acore::StringFormat("SELECT owner, {} FROM character_guardian WHERE owner IN ({})",
+                GUARDIAN_LOAD_COLUMNS, in.str());
+            metrics.loginBatches.fetch_add(1, std::memory_order_relaxed);
+            metrics.loginBatchOwners.fetch_add(owners.size(), std::memory_order_relaxed);
+        }
+
+        _callbacks.AddCallback(CharacterDatabase.AsyncQuery(sql).WithCallback(
+            [this, owners = std::move(owners)](QueryResult result) { Deliver(owners, result); }));
+    }
+
+    void Deliver(std::vector<ObjectGuid> const& owners, QueryResult result)
+    {
+        CC_PROFILE_ZONE("GuardianLoginBatcher::Deliver");
+        if (result)
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+                Player* player = ObjectAccessor::FindPlayerByLowGUID(fields[0].Get<uint32>());
+                if (player && IsLoading(player->GetGUID()))
+                    ApplyGuardianRow(GetGuardianData(player), fields + 1);
+            }
+            while (result->NextRow());
+        }
+
+        for (ObjectGuid const& guid : owners)
+        {
+            if (!_loading.erase(guid))
+                continue;
+
+            if (Player* player = ObjectAccessor::FindPlayer(guid))
+                FinishGuardianLogin(player);
+        }
+    }
+
+    std::vector<ObjectGuid> _pending;
+    std::vector<ObjectGuid> _waitingOnWrites;
+    std::unordered_set<ObjectGuid> _loading;
+    uint32 _windowTimer = 0;
+    QueryCallbackProcessor _callbacks;
+};
+
+static GuardianLoginBatcher s_loginBatcher;
+
+// Until the saved slots arrive they look empty in memory; anything that picks
+// a free slot must wait, or it would write over a stored guardian.
+static bool IsGuardianLoginPending(Player* player)
+{
+    return s_loginBatcher.IsLoading(player->GetGUID());
+}
+
 // ============================================================================
 // Player Script — Handle teleport, logout, login
 // ============================================================================
@@ -4270,8 +8386,6 @@ public:
         if (!config.enabled)
             return;
 
-        LoadGuardiansFromDb(player);
-
         if (!player->HasItemCount(ITEM_TESSERACT, 1))
         {
             if (player->AddItem(ITEM_TESSERACT, 1))
@@ -4281,59 +8395,76 @@ public:
             }
         }
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-        bool anyOccupied = false;
-        for (uint8 i = 0; i < config.maxSlots; ++i)
-        {
-            GuardianSlotData& s = data->slots[i];
-            if (!s.IsOccupied())
-                continue;
-
-            anyOccupied = true;
-            CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(s.guardianEntry);
-            std::string name = cInfo ? cInfo->Name : "Guardian";
+        uint32 ownerGuid = player->GetGUID().GetCounter();
 
-            if (!s.dismissed)
-            {
-                // Auto-summon guardians that were not explicitly dismissed
-                if (SummonGuardianSlot(player, i, false))
-                {
-                    ChatHandler(player->GetSession()).PSendSysMessage(
-                        "|cff00ff00[Creature Capture]|r Slot {}: {} ({}) summoned.",
-                        i + 1, name, ArchetypeName(s.archetype));
-                }
-            }
-            else
+        // Relogged within WarmCache.TtlSeconds: hydrate without a query
+        CapturedGuardianData warm;
+        if (s_warmCache.Take(ownerGuid, warm))
+        {
+            CapturedGuardianData* data = nullptr;
+            for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
             {
-                ChatHandler(player->GetSession()).PSendSysMessage(
-                    "|cff00ff00[Creature Capture]|r Slot {}: {} ({}) stored in Tesseract.",
-                    i + 1, name, ArchetypeName(s.archetype));
+                if (!warm.slots[i].IsOccupied() && !warm.slots[i].HasPreservedProgress())
+                    continue;
+                if (!data)
+                    data = GetGuardianData(player);
+                data->slots[i] = std::move(warm.slots[i]);
             }
+            FinishGuardianLogin(player);
+            return;
         }
 
-        if (anyOccupied)
+        // Saves from a just-ended session may still be in the write lane;
+        // load once they have committed rather than waiting here
+        if (s_writeLane.HasPending(ownerGuid))
         {
-            SendAllSlotsState(player);
+            s_writeLane.Prioritize(ownerGuid);
+            s_loginBatcher.EnqueueAfterWrites(player);
+            return;
         }
-        else if (config.announce)
+
+        if (config.loginBatchEnabled)
         {
-            ChatHandler(player->GetSession()).PSendSysMessage(
-                "|cff00ff00[Creature Capture]|r Target a creature and use your Tesseract to capture it!");
+            s_loginBatcher.Enqueue(player);
+            return;
         }
+
+        LoadGuardiansFromDb(player);
+        FinishGuardianLogin(player);
+    }
+
+    void OnPlayerUpdate(Player* player, uint32 p_time) override
+    {
+        UpdateGuardians(player, p_time);
+        FlushCaptureAddonMessages(player);
     }
 
-    void OnPlayerUpdate(Player* player, uint32 /*p_time*/) override
+    void UpdateGuardians(Player* player, uint32 p_time)
     {
         if (!config.enabled)
             return;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-        bool mountedOrFlying = player->IsMounted() || player->IsInFlight();
+        CapturedGuardianData* data = FindGuardianData(player);
+        if (!data)
+            return;
 
-        if (mountedOrFlying)
+        FeedPreviewState& fp = data->feedPreview;
+        if (fp.pendingItem)
         {
-            // Temporarily despawn any active guardians while mounted/flying
-            for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
+            fp.pendingTimer -= static_cast<int32>(p_time);
+            if (fp.pendingTimer <= 0)
+                ServeFeedPreview(player, data);
+        }
+        // Mounted or flying owners keep no guardians out; elsewhere the zone
+        // rules cap how many may be. The excess is temporarily despawned from
+        // the highest slot down and comes back when the cap allows.
+        uint8 allowed = (player->IsMounted() || player->IsInFlight())
+            ? 0 : s_zoneRules.For(player).maxGuardians;
+        uint8 active = CountActiveGuardians(data);
+
+        if (active > allowed)
+        {
+            for (uint8 i = MAX_GUARDIAN_SLOTS; i-- > 0 && active > allowed;)
             {
                 GuardianSlotData& s = data->slots[i];
                 if (!s.IsActive())
@@ -4344,9 +8475,11 @@ public:
                     guardian->DespawnOrUnsummon();
                 s.guardianGuid.Clear();
                 SendGuardianDismiss(player, i);
+                BumpSlotVersion(player, i);
+                --active;
             }
         }
-        else
+        else if (active < allowed)
         {
             // Resummon any occupied, non-dismissed guardians that aren't currently active
             for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
@@ -4360,7 +8493,11 @@ public:
 
     void OnPlayerLogout(Player* player) override
     {
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        s_loginBatcher.Cancel(player->GetGUID());
+
+        CapturedGuardianData* data = FindGuardianData(player);
+        if (!data)
+            return;
 
         // Snapshot & despawn all active guardians, preserving their dismissed state
         for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
@@ -4374,11 +8511,15 @@ public:
             s.guardianGuid.Clear();
         }
         SaveAllGuardiansToDb(player);
+        s_warmCache.Put(player->GetGUID().GetCounter(), *data);
     }
 
     bool OnPlayerBeforeTeleport(Player* player, uint32 mapId, float x, float y, float z, float /*orientation*/, uint32 /*options*/, Unit* /*target*/) override
     {
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
+        if (!data)
+            return true;
+
         bool sameMap = (player->GetMapId() == mapId);
 
         for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
@@ -4409,19 +8550,23 @@ public:
                 guardian->DespawnOrUnsummon();
                 s.guardianGuid.Clear();
                 SendGuardianDismiss(player, i);
+                BumpSlotVersion(player, i);
             }
         }
 
         return true;
     }
 
-    void OnPlayerLevelChanged(Player* player, uint8 /*oldLevel*/) override
+    void OnPlayerLevelChanged(Player* player, uint8 oldLevel) override
     {
         if (!config.enabled)
             return;
 
+        CapturedGuardianData* data = FindGuardianData(player);
+        if (!data)
+            return;
+
         uint8 newLevel = player->GetLevel();
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
 
         for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
         {
@@ -4430,6 +8575,8 @@ public:
                 continue;
 
             s.guardianLevel = newLevel;
+            LogCaptureEvent(CAPTURE_EVENT_LEVEL, player, i, s, oldLevel);
+            NotifyGuardianLevelChanged(player, i, s, oldLevel);
 
             if (s.IsActive())
             {
@@ -4461,6 +8608,9 @@ public:
 
     void OnPlayerMapChanged(Player* player) override
     {
+        if (!FindGuardianData(player))
+            return;
+
         // Re-summon guardians that were temporarily despawned for map change
         for (uint8 i = 0; i < MAX_GUARDIAN_SLOTS; ++i)
             SummonGuardianSlot(player, i, false);
@@ -4484,12 +8634,98 @@ class CreatureCaptureWorldScript : public WorldScript
 public:
     CreatureCaptureWorldScript() : WorldScript("CreatureCaptureWorldScript") {}
 
-    void OnAfterConfigLoad(bool /*reload*/) override
+    void OnAfterConfigLoad(bool reload) override
     {
         config.Load();
+        if (reload)
+            ReapplyGuardianConfigScaling();
+    }
+
+    void OnStartup() override
+    {
+        s_tableCache.LoadOrBuild();
+
+        uint32 ruleCount = s_zoneRules.Load();
+        LOG_INFO("module", "mod-creature-capture: loaded {} zone rules", ruleCount);
+        s_eventLog.Start();
+        s_writeLane.Start();
+        s_aiBatch.Start();
+    }
+
+    void OnShutdown() override
+    {
+        s_audit.Stop();
+        s_eventLog.Stop();
+        s_writeLane.Stop();
+        s_aiBatch.Stop();
+    }
+
+    void OnUpdate(uint32 diff) override
+    {
+        s_tableCache.Update();
+        s_writeLane.Update();
+        s_loginBatcher.Update(diff);
+        s_audit.Update();
+        // Maps are idle here: decide the guardian snapshots they queued last tick
+        s_aiBatch.Update();
     }
 };
 
+// ============================================================================
+// Gossip Menu Labels — cached per slot
+// ============================================================================
+
+// Resource choices offered in the guardian gossip, in menu order
+static struct { uint8 power; char const* name; } const GUARDIAN_RESOURCE_TYPES[] = {
+    { POWER_MANA,   "Mana"   },
+    { POWER_RAGE,   "Rage"   },
+    { POWER_FOCUS,  "Focus"  },
+    { POWER_ENERGY, "Energy" },
+};
+
+static GuardianMenuLabels const& GetSlotMenuLabels(GuardianSlotData& s, uint8 slot)
+{
+    GuardianMenuLabels& m = s.menuLabels;
+    if (m.built && m.entry == s.guardianEntry && m.slot == slot && m.archetype == s.archetype &&
+        m.rangedDps == s.rangedDps && m.powerChosen == s.powerChosen && m.powerType == s.guardianPowerType)
+        return m;
+
+    m.entry       = s.guardianEntry;
+    m.slot        = slot;
+    m.archetype   = s.archetype;
+    m.rangedDps   = s.rangedDps;
+    m.powerChosen = s.powerChosen;
+    m.powerType   = s.guardianPowerType;
+    m.built       = true;
+
+    CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(s.guardianEntry);
+    std::string name = cInfo ? cInfo->Name : "Guardian";
+    std::string index = std::to_string(slot + 1);
+
+    m.summon  = "[" + index + "] Summon " + name + " (" + ArchetypeName(s.archetype) + ")";
+    m.dismiss = "[" + index + "] Dismiss " + name + " (" + ArchetypeName(s.archetype) + ")";
+    m.release = "Release [" + index + "] " + name + " (permanent)";
+
+    m.archetypeSwitch[ARCHETYPE_DPS]    = std::string("[DPS] Switch to DPS")       + (s.archetype == ARCHETYPE_DPS    ? " (active)" : "");
+    m.archetypeSwitch[ARCHETYPE_TANK]   = std::string("[Tank] Switch to Tank")     + (s.archetype == ARCHETYPE_TANK   ? " (active)" : "");
+    m.archetypeSwitch[ARCHETYPE_HEALER] = std::string("[Healer] Switch to Healer") + (s.archetype == ARCHETYPE_HEALER ? " (active)" : "");
+
+    m.stanceMelee  = std::string("[Stance] Melee DPS")  + (!s.rangedDps ? " (active)" : "");
+    m.stanceRanged = std::string("[Stance] Ranged DPS") + (s.rangedDps ? " (active)" : "");
+
+    for (uint8 r = 0; r < 4; ++r)
+    {
+        std::string& label = m.resourceSwitch[r];
+        label = std::string("[Resource] Switch to ") + GUARDIAN_RESOURCE_TYPES[r].name;
+        if (!s.powerChosen)
+            label += " (free first pick)";
+        else if (s.guardianPowerType == GUARDIAN_RESOURCE_TYPES[r].power)
+            label += " (active)";
+    }
+
+    return m;
+}
+
 // ============================================================================
 // Tesseract Item Script (multi-slot gossip)
 // ============================================================================
@@ -4504,7 +8740,15 @@ public:
         if (!player || !item)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        // Saved slots are still on their way from the login batcher
+        if (IsGuardianLoginPending(player))
+        {
+            ChatHandler(player->GetSession()).PSendSysMessage(
+                "|cffff0000[Tesseract]|r Your guardians are still loading. Try again in a moment.");
+            return true;
+        }
+
+        CapturedGuardianData* data = GetGuardianData(player);
 
         // Check if targeting a capturable creature
         Creature* target = ObjectAccessor::GetCreatureOrPetOrVehicle(*player, player->GetTarget());
@@ -4550,21 +8794,18 @@ public:
                 continue;
 
             anyOccupied = true;
-            CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(s.guardianEntry);
-            std::string name = cInfo ? cInfo->Name : "Guardian";
+            GuardianMenuLabels const& labels = GetSlotMenuLabels(s, i);
 
             if (s.IsActive())
             {
                 // Active guardian — clicking dismisses
-                std::string label = "[" + std::to_string(i + 1) + "] Dismiss " + name + " (" + ArchetypeName(s.archetype) + ")";
-                AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, label,
+                AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, labels.dismiss,
                     GOSSIP_SENDER_MAIN, i * 10 + TESSERACT_ACTION_DISMISS);
             }
             else if (!player->IsInCombat())
             {
                 // Stored guardian — clicking summons (only outside combat)
-                std::string label = "[" + std::to_string(i + 1) + "] Summon " + name + " (" + ArchetypeName(s.archetype) + ")";
-                AddGossipItemFor(player, GOSSIP_ICON_CHAT, label,
+                AddGossipItemFor(player, GOSSIP_ICON_CHAT, labels.summon,
                     GOSSIP_SENDER_MAIN, i * 10 + TESSERACT_ACTION_SUMMON);
             }
         }
@@ -4576,10 +8817,7 @@ public:
             if (!s.IsOccupied())
                 continue;
 
-            CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(s.guardianEntry);
-            std::string name = cInfo ? cInfo->Name : "Guardian";
-            std::string label = "Release [" + std::to_string(i + 1) + "] " + name + " (permanent)";
-            AddGossipItemFor(player, GOSSIP_ICON_BATTLE, label,
+            AddGossipItemFor(player, GOSSIP_ICON_BATTLE, GetSlotMenuLabels(s, i).release,
                 GOSSIP_SENDER_MAIN, i * 10 + TESSERACT_ACTION_RELEASE);
         }
 
@@ -4624,7 +8862,7 @@ public:
             return;
         }
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = GetGuardianData(player);
 
         // Handle bulk actions
         if (action == TESSERACT_ACTION_SUMMON_ALL)
@@ -4685,6 +8923,11 @@ public:
                     ChatHandler(player->GetSession()).PSendSysMessage(
                         "|cff00ff00[Tesseract]|r {} summoned from slot {}!", guardian->GetName(), slot + 1);
                 }
+                else if (CountActiveGuardians(data) >= s_zoneRules.For(player).maxGuardians)
+                {
+                    ChatHandler(player->GetSession()).PSendSysMessage(
+                        "|cffff0000[Tesseract]|r No more guardians may be summoned here.");
+                }
                 else
                 {
                     ChatHandler(player->GetSession()).PSendSysMessage(
@@ -4772,6 +9015,8 @@ public:
                 if (preserveCost > 0)
                     player->ModifyMoney(-static_cast<int32>(preserveCost));
 
+                LogCaptureEvent(CAPTURE_EVENT_RELEASE, player, slot, s, 1);
+                NotifyGuardianReleased(player, slot, s, true);
                 s.ClearCreature();
                 // Persist the preserved spells/stats so they survive relog
                 SaveGuardianSlotToDb(player, &s, slot);
@@ -4780,6 +9025,7 @@ public:
                     "|cffff6600[Tesseract]|r {} released. Slot progress preserved for the next guardian.", name);
 
                 SendGuardianClear(player, slot);
+                BumpSlotVersion(player, slot);
                 break;
             }
             case TESSERACT_ACTION_RELEASE_WIPE:
@@ -4800,6 +9046,8 @@ public:
                 else if (CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(s.guardianEntry))
                     name = cInfo->Name;
 
+                LogCaptureEvent(CAPTURE_EVENT_RELEASE, player, slot, s, 0);
+                NotifyGuardianReleased(player, slot, s, false);
                 s.Clear();
                 DeleteGuardianSlotFromDb(player, slot);
 
@@ -4807,6 +9055,7 @@ public:
                     "|cffff6600[Tesseract]|r {} released. All slot progress erased.", name);
 
                 SendGuardianClear(player, slot);
+                BumpSlotVersion(player, slot);
                 break;
             }
             default:
@@ -4830,7 +9079,10 @@ public:
         if (!config.enabled || !player || !creature)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
+        if (!data)
+            return false;
+
         int8 slot = data->FindSlotByGuid(creature->GetGUID());
         if (slot < 0)
             return false;
@@ -4842,56 +9094,37 @@ public:
         player->PrepareGossipMenu(creature, creature->GetGossipMenuId(), true);
 
         GuardianSlotData& s = data->slots[slot];
+        GuardianMenuLabels const& labels = GetSlotMenuLabels(s, static_cast<uint8>(slot));
 
         // Append archetype selection with slot-encoded actions
-        std::string dpsLabel   = std::string("[DPS] Switch to DPS")        + (s.archetype == ARCHETYPE_DPS    ? " (active)" : "");
-        std::string tankLabel  = std::string("[Tank] Switch to Tank")      + (s.archetype == ARCHETYPE_TANK   ? " (active)" : "");
-        std::string healLabel  = std::string("[Healer] Switch to Healer")  + (s.archetype == ARCHETYPE_HEALER ? " (active)" : "");
-
         // Encode: 100 + slot*10 + subAction
-        AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, dpsLabel,  GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + ARCHETYPE_DPS);
-        AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, tankLabel, GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + ARCHETYPE_TANK);
-        AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, healLabel, GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + ARCHETYPE_HEALER);
+        AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, labels.archetypeSwitch[ARCHETYPE_DPS],    GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + ARCHETYPE_DPS);
+        AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, labels.archetypeSwitch[ARCHETYPE_TANK],   GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + ARCHETYPE_TANK);
+        AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, labels.archetypeSwitch[ARCHETYPE_HEALER], GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + ARCHETYPE_HEALER);
 
         // DPS stance: melee vs ranged (only shown for DPS guardians)
         if (s.archetype == ARCHETYPE_DPS)
         {
-            std::string meleeLabel = std::string("[Stance] Melee DPS") + (!s.rangedDps ? " (active)" : "");
-            std::string rangedLabel = std::string("[Stance] Ranged DPS") + (s.rangedDps ? " (active)" : "");
-            AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, meleeLabel,  GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + GUARDIAN_DPS_MELEE);
-            AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, rangedLabel, GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + GUARDIAN_DPS_RANGED);
+            AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, labels.stanceMelee,  GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + GUARDIAN_DPS_MELEE);
+            AddGossipItemFor(player, GOSSIP_ICON_INTERACT_1, labels.stanceRanged, GOSSIP_SENDER_MAIN, GUARDIAN_ACTION_BASE + slot * 10 + GUARDIAN_DPS_RANGED);
         }
 
         // Append resource type selection
         uint32 switchCostCopper = s.powerChosen ? CalculateResourceSwitchCost(s.guardianLevel) : 0;
 
-        struct { uint8 power; const char* name; } resourceTypes[] = {
-            { POWER_MANA,   "Mana"   },
-            { POWER_RAGE,   "Rage"   },
-            { POWER_FOCUS,  "Focus"  },
-            { POWER_ENERGY, "Energy" },
-        };
-
-        for (auto const& rt : resourceTypes)
+        for (uint8 r = 0; r < 4; ++r)
         {
-            std::string label = std::string("[Resource] Switch to ") + rt.name;
-            uint32 actionId = GUARDIAN_ACTION_BASE + slot * 10 + GUARDIAN_RESOURCE_OFFSET + rt.power;
-            if (s.powerChosen && s.guardianPowerType == rt.power)
-            {
-                label += " (active)";
-                AddGossipItemFor(player, GOSSIP_ICON_MONEY_BAG, label,
-                    GOSSIP_SENDER_MAIN, actionId);
-            }
-            else if (s.powerChosen)
+            uint8 power = GUARDIAN_RESOURCE_TYPES[r].power;
+            uint32 actionId = GUARDIAN_ACTION_BASE + slot * 10 + GUARDIAN_RESOURCE_OFFSET + power;
+            if (s.powerChosen && s.guardianPowerType != power)
             {
-                AddGossipItemFor(player, GOSSIP_ICON_MONEY_BAG, label,
+                AddGossipItemFor(player, GOSSIP_ICON_MONEY_BAG, labels.resourceSwitch[r],
                     GOSSIP_SENDER_MAIN, actionId,
                     "Switch this guardian's resource type?", switchCostCopper, false);
             }
             else
             {
-                label += " (free first pick)";
-                AddGossipItemFor(player, GOSSIP_ICON_MONEY_BAG, label,
+                AddGossipItemFor(player, GOSSIP_ICON_MONEY_BAG, labels.resourceSwitch[r],
                     GOSSIP_SENDER_MAIN, actionId);
             }
         }
@@ -4919,8 +9152,8 @@ public:
 
         if (action == GUARDIAN_ACTION_DISMISS)
         {
-            CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
-            int8 slot = data->FindSlotByGuid(creature->GetGUID());
+            CapturedGuardianData* data = FindGuardianData(player);
+            int8 slot = data ? data->FindSlotByGuid(creature->GetGUID()) : -1;
             if (slot < 0 || !data->slots[slot].IsActive())
                 return false;
 
@@ -4938,7 +9171,10 @@ public:
         if (slot >= MAX_GUARDIAN_SLOTS)
             return false;
 
-        CapturedGuardianData* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        CapturedGuardianData* data = FindGuardianData(player);
+        if (!data)
+            return false;
+
         GuardianSlotData& s = data->slots[slot];
 
         if (!s.IsActive() || s.guardianGuid != creature->GetGUID())
@@ -5004,6 +9240,7 @@ public:
 
             SaveGuardianSlotToDb(player, &s, slot);
             SendGuardianPower(player, slot, newPowerType);
+            BumpSlotVersion(player, slot);
 
             return true;
         }
@@ -5074,6 +9311,7 @@ public:
             "|cff00ff00[Guardian]|r Slot {} switched to {} archetype.", slot + 1, ArchetypeName(newArchetype));
 
         SendGuardianArchetype(player, slot, newArchetype);
+        BumpSlotVersion(player, slot);
 
         return true;
     }
@@ -5102,9 +9340,9 @@ static GuardianSlotData* FindGuardianSlot(Unit const* unit)
     if (!owner)
         return nullptr;
 
-    CapturedGuardianData* data = owner->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+    CapturedGuardianData* data = FindGuardianData(owner);
     uint8 slotIdx = ai->GetSlotIndex();
-    if (slotIdx >= MAX_GUARDIAN_SLOTS)
+    if (!data || slotIdx >= MAX_GUARDIAN_SLOTS)
         return nullptr;
 
     return &data->slots[slotIdx];
@@ -5123,39 +9361,43 @@ public:
     // Melee damage: attacker is guardian → add bonus
     void ModifyMeleeDamage(Unit* /*target*/, Unit* attacker, uint32& damage) override
     {
+        CC_PROFILE_ZONE("CaptureGuardianUnitScript::ModifyMeleeDamage");
         GuardianSlotData* slot = FindGuardianSlot(attacker);
         if (!slot)
             return;
+        CC_PROFILE_ANNOTATE(slot->guardianEntry, slot->archetype);
 
         CapturedGuardianAI const* ai = dynamic_cast<CapturedGuardianAI const*>(attacker->ToCreature()->AI());
-        float ap = (ai && ai->IsRangedDps()) ? GetBonusRangedAP(*slot) : GetBonusMeleeAP(*slot);
+        float ap = (ai && ai->IsRangedDps()) ? slot->derived.rangedAP : slot->derived.meleeAP;
         float flatBonus = ap / 14.0f + slot->bonusWeaponDmg;
         if (flatBonus > 0.0f)
             damage += static_cast<uint32>(flatBonus);
     }
 
     // Spell damage: if attacker is guardian → add spell power bonus
-    void ModifySpellDamageTaken(Unit* /*target*/, Unit* attacker, int32& damage, SpellInfo const* /*spellInfo*/) override
+    void ModifySpellDamageTaken(Unit* /*target*/, Unit* attacker, int32& damage, SpellInfo const* spellInfo) override
     {
+        CC_PROFILE_ZONE("CaptureGuardianUnitScript::ModifySpellDamageTaken");
         GuardianSlotData* slot = FindGuardianSlot(attacker);
         if (!slot)
             return;
+        CC_PROFILE_ANNOTATE(slot->guardianEntry, slot->archetype);
 
-        float sp = GetBonusSpellPower(*slot);
-        float flatBonus = sp * 0.3f; // average spell coefficient
+        float flatBonus = slot->derived.spellPower * GetSpellCoefficient(spellInfo).direct;
         if (flatBonus > 0.0f)
             damage += static_cast<int32>(flatBonus);
     }
 
     // Periodic (DoT) damage: if attacker is guardian → add spell power bonus
-    void ModifyPeriodicDamageAurasTick(Unit* /*target*/, Unit* attacker, uint32& damage, SpellInfo const* /*spellInfo*/) override
+    void ModifyPeriodicDamageAurasTick(Unit* /*target*/, Unit* attacker, uint32& damage, SpellInfo const* spellInfo) override
     {
+        CC_PROFILE_ZONE("CaptureGuardianUnitScript::ModifyPeriodicDamageAurasTick");
         GuardianSlotData* slot = FindGuardianSlot(attacker);
         if (!slot)
             return;
+        CC_PROFILE_ANNOTATE(slot->guardianEntry, slot->archetype);
 
-        float sp = GetBonusSpellPower(*slot);
-        float flatBonus = sp * 0.1f; // lower coefficient for DoTs
+        float flatBonus = slot->derived.spellPower * GetSpellCoefficient(spellInfo).dot;
         if (flatBonus > 0.0f)
             damage += static_cast<uint32>(flatBonus);
     }
@@ -5167,26 +9409,22 @@ public:
         int32& /*victimDefenseSkill*/, int32& crit_chance, int32& /*miss_chance*/,
         int32& dodge_chance, int32& parry_chance, int32& block_chance) override
     {
+        CC_PROFILE_ZONE("CaptureGuardianUnitScript::OnBeforeRollMeleeOutcomeAgainst");
         // If attacker is a guardian: boost crit chance
         GuardianSlotData* attackerSlot = FindGuardianSlot(attacker);
         if (attackerSlot)
         {
-            float critPct = GetBonusCritPct(*attackerSlot);
-            crit_chance += static_cast<int32>(critPct * 100.0f); // units are 0.01%
+            crit_chance += static_cast<int32>(attackerSlot->derived.critPct * 100.0f); // units are 0.01%
         }
 
         // If victim is a guardian: boost dodge/parry/block chance
         GuardianSlotData* victimSlot = FindGuardianSlot(victim);
         if (victimSlot)
         {
-            float dodgePct = GetBonusDodgePct(*victimSlot);
-            dodge_chance += static_cast<int32>(dodgePct * 100.0f);
-
-            float parryPct = GetBonusParryPct(*victimSlot);
-            parry_chance += static_cast<int32>(parryPct * 100.0f);
-
-            float blockPct = GetBonusBlockPct(*victimSlot);
-            block_chance += static_cast<int32>(blockPct * 100.0f);
+            GuardianDerivedStats const& d = victimSlot->derived;
+            dodge_chance += static_cast<int32>(d.dodgePct * 100.0f);
+            parry_chance += static_cast<int32>(d.parryPct * 100.0f);
+            block_chance += static_cast<int32>(d.blockPct * 100.0f);
         }
     }
 };
@@ -5217,7 +9455,7 @@ class spell_creature_capture_channel : public AuraScript
             return;
 
         Player* player = caster->ToPlayer();
-        auto* data = player->CustomData.GetDefault<CapturedGuardianData>("CapturedGuardian");
+        auto* data = GetGuardianData(player);
 
         uint8 slot = data->pendingCaptureSlot;
         data->pendingCaptureTarget = ObjectGuid::Empty;